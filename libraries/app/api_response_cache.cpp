@@ -0,0 +1,128 @@
+#include <scorum/app/api_response_cache.hpp>
+
+namespace scorum {
+namespace app {
+
+api_response_cache::api_response_cache(size_t max_size)
+    : _max_size(max_size)
+{
+}
+
+void api_response_cache::set_max_size(size_t max_size)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _max_size = max_size;
+
+    while (_entries.size() > _max_size)
+    {
+        erase(_order.front());
+        _order.pop_front();
+    }
+}
+
+void api_response_cache::enable_method(const std::string& method, const method_config& config)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _methods[method] = config;
+    _stats[method];
+}
+
+bool api_response_cache::begin_lookup(const std::string& method, uint64_t& generation) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_max_size == 0 || _methods.find(method) == _methods.end())
+        return false;
+
+    generation = _generation;
+    return true;
+}
+
+std::shared_ptr<const void> api_response_cache::find(const std::string& method, const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& method_stats = _stats[method];
+
+    auto it = _entries.find(key);
+    if (it == _entries.end() || (it->second.with_ttl && it->second.expires <= std::chrono::steady_clock::now()))
+    {
+        ++method_stats.misses;
+        return {};
+    }
+
+    ++method_stats.hits;
+    return it->second.value;
+}
+
+void api_response_cache::insert(const std::string& method,
+                                const std::string& key,
+                                std::shared_ptr<const void> value,
+                                uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // a block was applied while the result was being computed
+    if (generation != _generation || _max_size == 0)
+        return;
+
+    const auto& config = _methods[method];
+
+    entry e;
+    e.method = method;
+    e.value = std::move(value);
+    e.with_ttl = config.ttl_ms > 0;
+    e.expires = std::chrono::steady_clock::now() + std::chrono::milliseconds(config.ttl_ms);
+
+    auto it = _entries.find(key);
+    if (it != _entries.end())
+    {
+        // expired by TTL, keeps its place in the eviction order
+        it->second = std::move(e);
+        return;
+    }
+
+    _entries.emplace(key, std::move(e));
+    _order.push_back(key);
+    ++_stats[method].size;
+
+    while (_entries.size() > _max_size)
+    {
+        erase(_order.front());
+        _order.pop_front();
+    }
+}
+
+void api_response_cache::erase(const std::string& key)
+{
+    auto it = _entries.find(key);
+    if (it == _entries.end())
+        return;
+
+    --_stats[it->second.method].size;
+    _entries.erase(it);
+}
+
+void api_response_cache::invalidate()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ++_generation;
+
+    _entries.clear();
+    _order.clear();
+
+    for (auto& s : _stats)
+        s.second.size = 0;
+}
+
+api_response_cache::stats_map api_response_cache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _stats;
+}
+}
+}
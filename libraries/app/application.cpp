@@ -28,6 +28,8 @@
 #include <scorum/app/betting_api.hpp>
 #include <scorum/app/api_access.hpp>
 #include <scorum/app/application.hpp>
+#include <scorum/app/block_notification_watcher.hpp>
+#include <scorum/app/transaction_prevalidator.hpp>
 #include <scorum/app/plugin.hpp>
 #include <scorum/account_statistics/account_statistics_api.hpp>
 #include <scorum/account_statistics/account_statistics_plugin.hpp>
@@ -40,6 +42,7 @@
 #include <scorum/chain/schema/scorum_objects.hpp>
 #include <scorum/chain/schema/scorum_object_types.hpp>
 #include <scorum/chain/database_exceptions.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
 #include <scorum/chain/genesis/genesis_state.hpp>
 #include <scorum/egenesis/egenesis.hpp>
 
@@ -68,6 +71,7 @@
 #include <iostream>
 #include <fstream>
 #include <set>
+#include <thread>
 
 #include <fc/log/file_appender.hpp>
 #include <fc/log/logger.hpp>
@@ -164,6 +168,19 @@ public:
                 ilog("Setting p2p max connections to ${n}", ("n", node_param["maximum_number_of_connections"]));
             }
 
+            fc::mutable_variant_object transaction_limit_params;
+            if (_options->count("p2p-peer-transactions-per-second"))
+                transaction_limit_params["peer_transactions_per_second"]
+                    = _options->at("p2p-peer-transactions-per-second").as<uint32_t>();
+            if (_options->count("p2p-peer-transactions-burst"))
+                transaction_limit_params["peer_transactions_burst"]
+                    = _options->at("p2p-peer-transactions-burst").as<uint32_t>();
+            if (transaction_limit_params.size())
+            {
+                _p2p_network->set_advanced_node_parameters(transaction_limit_params);
+                ilog("Setting p2p transaction limits to ${params}", ("params", transaction_limit_params));
+            }
+
             _p2p_network->listen_to_p2p_network();
             ilog("Configured p2p node to listen on ${ip}", ("ip", _p2p_network->get_actual_listening_endpoint()));
 
@@ -372,6 +389,8 @@ public:
                 }
 
                 _chain_db->set_flush_interval(_options->at("flush").as<uint32_t>());
+                _chain_db->set_signature_recovery_threads(
+                    _options->at("signature-recovery-threads").as<uint32_t>());
 
                 flat_map<uint32_t, block_id_type> loaded_checkpoints;
                 if (_options->count("checkpoint"))
@@ -429,6 +448,10 @@ public:
             }
             _chain_db->show_free_memory(true);
 
+            configure_block_notification_watcher();
+            configure_api_response_cache();
+            configure_transaction_prevalidator();
+
             if (_options->count("api-user"))
             {
                 for (const std::string& api_access_str : _options->at("api-user").as<std::vector<std::string>>())
@@ -482,6 +505,107 @@ public:
         FC_LOG_AND_RETHROW()
     }
 
+    void configure_block_notification_watcher()
+    {
+        if (!_self->is_read_only())
+            return;
+
+        auto notifier = _chain_db->get_block_notifier();
+        if (!notifier.valid())
+        {
+            wlog("Shared memory file has no block notification state, restart the write node to create it. "
+                 "Head block notifications and the API response cache are disabled.");
+            return;
+        }
+
+        fc::thread* main_thread = &fc::thread::current();
+        _block_notification_watcher = std::make_unique<block_notification_watcher>(
+            notifier, [this, main_thread](const chainbase::block_notification& notification) {
+                // the writer has already changed the state when it announces the block
+                _api_response_cache.invalidate();
+
+                uint32_t block_num = notification.block_num;
+                main_thread->async(
+                    [this, block_num]() {
+                        if (_running)
+                            _self->head_block_notified(block_num);
+                    },
+                    "head_block_notified");
+            });
+    }
+
+    void configure_api_response_cache()
+    {
+        // read only nodes do not apply blocks themselves, the writer announces its blocks through the shared memory
+        if (_self->is_read_only() && !_block_notification_watcher)
+            return;
+
+        // no method is cached by default, cached results don't reflect pending transactions
+        if (!_options->count("api-cache-method"))
+            return;
+
+        _api_response_cache.set_max_size(_options->at("api-cache-size").as<uint32_t>());
+
+        for (const std::string& arg : _options->at("api-cache-method").as<std::vector<std::string>>())
+        {
+            std::vector<std::string> methods;
+            boost::split(methods, arg, boost::is_any_of(" \t,"), boost::token_compress_on);
+            for (const std::string& method : methods)
+            {
+                if (method.empty())
+                    continue;
+
+                // <api>.<method>[:<ttl ms>]
+                api_response_cache::method_config config;
+                auto pos = method.find(':');
+                if (pos != std::string::npos)
+                    config.ttl_ms = boost::lexical_cast<uint32_t>(method.substr(pos + 1));
+
+                _api_response_cache.enable_method(method.substr(0, pos), config);
+            }
+        }
+
+        if (_self->is_read_only())
+            return;
+
+        _applied_block_connection
+            = _chain_db->applied_block.connect([&](const signed_block&) { _api_response_cache.invalidate(); });
+        _popped_block_connection
+            = _chain_db->popped_block.connect([&](const signed_block&) { _api_response_cache.invalidate(); });
+    }
+
+    void configure_transaction_prevalidator()
+    {
+        // read only nodes don't receive transactions from the network
+        if (_self->is_read_only())
+            return;
+
+        _trx_prevalidator = std::make_unique<transaction_prevalidator>(
+            _chain_db->get_signature_cache(), _chain_db->get_chain_id(),
+            _options->at("transaction-prevalidation-threads").as<uint32_t>());
+
+        _chain_db->with_read_lock([&]() { _trx_prevalidator->set_head(get_prevalidation_head()); });
+
+        _trx_prevalidator_applied_block_connection = _chain_db->applied_block.connect(
+            [&](const signed_block&) { _trx_prevalidator->set_head(get_prevalidation_head()); });
+        _trx_prevalidator_popped_block_connection = _chain_db->popped_block.connect([&](const signed_block& block) {
+            _trx_prevalidator->forget_block(block.block_num());
+            _trx_prevalidator->set_head(get_prevalidation_head());
+        });
+    }
+
+    transaction_prevalidator::head_state get_prevalidation_head() const
+    {
+        transaction_prevalidator::head_state head;
+        head.block_num = _chain_db->head_block_num();
+        head.block_id = _chain_db->head_block_id();
+        head.time = _chain_db->head_block_time();
+        // the same limit as database::push_transaction checks
+        head.max_transaction_size
+            = _chain_db->dynamic_global_property_service().get().median_chain_props.maximum_block_size - 256;
+        return head;
+    }
+
     optional<api_access_info> get_api_access_info(const std::string& username) const
     {
         optional<api_access_info> result;
@@ -640,7 +764,10 @@ public:
         {
             if (_running)
             {
-                _chain_db->push_transaction(transaction_message.trx);
+                // stateless checks and signature recovery are done by the prevalidation threads, only transactions
+                // passing them are pushed under the database lock
+                _trx_prevalidator->process(transaction_message.trx,
+                                           [&](const signed_transaction& trx) { _chain_db->push_transaction(trx); });
             }
         }
         FC_CAPTURE_AND_RETHROW((transaction_message))
@@ -747,14 +874,21 @@ public:
             if (id.item_type == graphene::net::block_message_type)
             {
                 return _chain_db->with_read_lock([&]() {
-                    auto opt_block = _chain_db->fetch_block_by_id(id.item_hash);
-                    if (!opt_block)
+                    auto opt_packed_block = _chain_db->fetch_packed_block_by_id(id.item_hash);
+                    if (!opt_packed_block)
                         elog("Couldn't find block ${id} -- corresponding ID in our chain is ${id2}",
                              ("id", id.item_hash)(
                                  "id2", _chain_db->get_block_id_for_num(block_header::num_from_id(id.item_hash))));
-                    FC_ASSERT(opt_block.valid());
-                    // ilog("Serving up block #${num}", ("num", opt_block->block_num()));
-                    return block_message(std::move(*opt_block));
+                    FC_ASSERT(opt_packed_block.valid());
+
+                    // block_message is (block)(block_id), reuse the already serialized block
+                    message result;
+                    result.msg_type = block_message::type;
+                    result.data = std::move(*opt_packed_block);
+                    const auto packed_id = fc::raw::pack(block_id_type(id.item_hash));
+                    result.data.insert(result.data.end(), packed_id.begin(), packed_id.end());
+                    result.size = (uint32_t)result.data.size();
+                    return result;
                 });
             }
             return _chain_db->with_read_lock(
@@ -1050,6 +1184,10 @@ public:
     void shutdown()
     {
         _running = false;
+        if (_block_notification_watcher)
+        {
+            _block_notification_watcher->stop();
+        }
         fc::usleep(fc::seconds(1));
         if (_p2p_network)
         {
@@ -1098,9 +1236,19 @@ public:
     int32_t _max_block_age = -1;
     uint64_t _shared_file_size;
 
-    bool _running;
+    bool _running = false;
 
     uint32_t allow_future_time = 5;
+
+    api_response_cache _api_response_cache;
+    boost::signals2::scoped_connection _applied_block_connection;
+    boost::signals2::scoped_connection _popped_block_connection;
+
+    std::unique_ptr<block_notification_watcher> _block_notification_watcher;
+
+    std::unique_ptr<transaction_prevalidator> _trx_prevalidator;
+    boost::signals2::scoped_connection _trx_prevalidator_applied_block_connection;
+    boost::signals2::scoped_connection _trx_prevalidator_popped_block_connection;
 };
 }
 
@@ -1116,6 +1264,8 @@ application::application(std::shared_ptr<chain::database> db)
 
 application::~application()
 {
+    // the watcher reads the shared memory file mapping, which is gone once the database is closed
+    my->_block_notification_watcher.reset();
     if (my->_p2p_network)
     {
         my->_p2p_network->close();
@@ -1127,6 +1277,19 @@ application::~application()
     }
 }
 
+api_response_cache& application::get_api_response_cache() const
+{
+    return my->_api_response_cache;
+}
+
+transaction_prevalidator::stats application::get_transaction_prevalidation_stats() const
+{
+    if (!my->_trx_prevalidator)
+        return {};
+
+    return my->_trx_prevalidator->get_stats();
+}
+
 std::vector<std::string> application::get_default_apis() const
 {
     std::vector<std::string> result;
@@ -1163,12 +1326,15 @@ void application::set_program_options(boost::program_options::options_descriptio
     const auto default_plugins = get_default_plugins();
 
     const std::string str_default_apis = boost::algorithm::join(default_apis, " ");
+
     const std::string str_default_plugins = boost::algorithm::join(default_plugins, " ");
 
     // clang-format off
     configuration_file_options.add_options()
     ("p2p-endpoint", bpo::value<std::string>(), "Endpoint for P2P node to listen on")
     ("p2p-max-connections", bpo::value<uint32_t>(), "Maxmimum number of incoming connections on P2P endpoint")
+    ("p2p-peer-transactions-per-second", bpo::value<uint32_t>(), "Transactions a P2P peer may send per second, the ones over the limit are dropped. 0 disables the limit")
+    ("p2p-peer-transactions-burst", bpo::value<uint32_t>(), "Transactions a P2P peer may send at once after being idle")
     ("seed-node,s", bpo::value<std::vector<std::string>>()->composing(), "P2P nodes to connect to on startup (may specify multiple times)")
     ("checkpoint,c", bpo::value<std::vector<std::string>>()->composing(), "Pairs of [BLOCK_NUM,BLOCK_ID] that should be enforced as checkpoints.")
     ("data-dir,d", bpo::value<boost::filesystem::path>()->default_value("witness_node_data_dir"), "Directory containing databases, configuration file, etc.")
@@ -1184,6 +1350,10 @@ void application::set_program_options(boost::program_options::options_descriptio
     ("enable-plugin", bpo::value< std::vector<std::string> >()->composing()->default_value(default_plugins, str_default_plugins), "Plugin(s) to enable, may be specified multiple times")
     ("max-block-age", bpo::value< int32_t >()->default_value(200), "Maximum age of head block when broadcasting tx via API")
     ("flush", bpo::value< uint32_t >()->default_value(100000), "Flush shared memory file to disk this many blocks")
+    ("api-cache-size", bpo::value< uint32_t >()->default_value(10000), "Maximum number of cached API results, 0 disables the cache")
+    ("api-cache-method", bpo::value< std::vector<std::string> >()->composing(), "API method to cache results of until the next block as <api>.<method>[:<ttl ms>], may be specified multiple times. Cached results ignore pending transactions, e.g. a balance stays as of the head block after a transfer is accepted")
+    ("signature-recovery-threads", bpo::value< uint32_t >()->default_value(std::max(1u, std::thread::hardware_concurrency() / 2)), "Threads recovering transaction signatures of a block before it is applied, 1 disables")
+    ("transaction-prevalidation-threads", bpo::value< uint32_t >()->default_value(2), "Threads checking transactions received from the network before they are pushed, 0 checks them on the main thread")
     ("genesis-json,g", bpo::value<boost::filesystem::path>(), "File to read genesis state from")
     ("replay-blockchain", "Rebuild object graph by replaying all blocks")
     ("replay-skip-witness-schedule-check", bpo::value<bool>()->default_value(true), "Skip witness schedule check wile block replaying")
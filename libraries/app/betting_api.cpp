@@ -1,5 +1,6 @@
 #include <scorum/app/betting_api.hpp>
 #include <scorum/app/betting_api_impl.hpp>
+#include <scorum/app/betting_event_stream.hpp>
 
 namespace scorum {
 namespace app {
@@ -13,6 +14,7 @@ betting_api::betting_api(const api_context& ctx)
                                    ctx.app.chain_database()->get_dba<matched_bet_object>(),
                                    ctx.app.chain_database()->get_dba<pending_bet_object>()))
     , _guard(ctx.app.chain_database())
+    , _db(ctx.app.chain_database())
 {
 }
 
@@ -37,6 +39,16 @@ std::vector<game_api_object> betting_api::get_games_by_status(const fc::flat_set
     return _guard->with_read_lock([&] { return _impl->get_games_by_status(filter); });
 }
 
+std::vector<game_api_object> betting_api::lookup_games_by_status(game_status status,
+                                                                 fc::time_point_sec start_from,
+                                                                 fc::time_point_sec start_to,
+                                                                 game_id_type from,
+                                                                 uint32_t limit) const
+{
+    return _guard->with_read_lock(
+        [&] { return _impl->lookup_games_by_status(status, start_from, start_to, from, limit); });
+}
+
 std::vector<game_api_object> betting_api::get_games_by_uuids(const std::vector<uuid_type>& uuids) const
 {
     return _guard->with_read_lock([&] { return _impl->get_games_by_uuids(uuids); });
@@ -77,6 +89,33 @@ std::vector<pending_bet_api_object> betting_api::get_game_pending_bets(const uui
     return _guard->with_read_lock([&] { return _impl->get_game_pending_bets(uuid); });
 }
 
+void betting_api::set_betting_events_callback(std::function<void(const fc::variant&)> cb,
+                                              const betting_events_filter& filter)
+{
+    _guard->with_read_lock([&] {
+        _events = std::make_shared<betting_event_stream>(
+            cb, filter, [this](int64_t matched_bet_id) { return _impl->get_matched_bet_game(matched_bet_id); });
+
+        _pre_applied_block_connection
+            = connect_signal(_db->pre_applied_block, *_events, &betting_event_stream::on_pre_applied_block);
+        _post_apply_operation_connection
+            = connect_signal(_db->post_apply_operation, *_events, &betting_event_stream::on_operation);
+        _applied_block_connection
+            = connect_signal(_db->applied_block, *_events, &betting_event_stream::on_applied_block);
+    });
+}
+
+void betting_api::cancel_betting_events_callback()
+{
+    _guard->with_read_lock([&] {
+        _pre_applied_block_connection.disconnect();
+        _post_apply_operation_connection.disconnect();
+        _applied_block_connection.disconnect();
+
+        _events.reset();
+    });
+}
+
 betting_property_api_object betting_api::get_betting_properties() const
 {
     return _guard->with_read_lock([&] { return _impl->get_betting_properties(); });
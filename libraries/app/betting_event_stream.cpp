@@ -0,0 +1,128 @@
+#include <scorum/app/betting_event_stream.hpp>
+
+#include <scorum/protocol/scorum_virtual_operations.hpp>
+
+namespace scorum {
+namespace app {
+
+using namespace scorum::protocol;
+
+namespace {
+
+struct betting_event_visitor
+{
+    using result_type = void;
+
+    template <typename Op> void operator()(const Op&) const
+    {
+    }
+
+    void operator()(const bets_matched_operation& op) const
+    {
+        handle(get_matched_bet_game(op.matched_bet_id), op.better1, op.better2);
+    }
+
+    void operator()(const bet_cancelled_operation& op) const
+    {
+        handle(op.game_uuid, op.better, account_name_type());
+    }
+
+    void operator()(const bet_resolved_operation& op) const
+    {
+        handle(op.game_uuid, op.better, account_name_type());
+    }
+
+    std::function<void(const uuid_type&, const account_name_type&, const account_name_type&)> handle;
+    const betting_event_stream::matched_bet_game_getter& get_matched_bet_game;
+};
+}
+
+betting_event_stream::betting_event_stream(callback_type callback,
+                                           const betting_events_filter& filter,
+                                           matched_bet_game_getter get_matched_bet_game,
+                                           uint32_t queue_limit)
+    : _callback(std::move(callback))
+    , _filter(filter)
+    , _get_matched_bet_game(std::move(get_matched_bet_game))
+    , _queue_limit(queue_limit)
+{
+}
+
+void betting_event_stream::on_pre_applied_block(const signed_block&)
+{
+    _events.clear();
+    _dropped = 0;
+    _in_block = true;
+}
+
+void betting_event_stream::on_operation(const chain::operation_notification& note)
+{
+    if (_in_block)
+        push(note.op);
+}
+
+void betting_event_stream::on_applied_block(const signed_block& block)
+{
+    if (_in_block)
+        flush(block.block_num());
+
+    _in_block = false;
+}
+
+void betting_event_stream::push(const operation& op)
+{
+    if (!_open)
+        return;
+
+    auto queue = [&](const uuid_type& game_uuid, const account_name_type& better1, const account_name_type& better2) {
+        if (!is_subscribed(game_uuid, better1, better2))
+            return;
+
+        if (_events.size() < _queue_limit)
+            _events.push_back({ game_uuid, op });
+        else
+            ++_dropped;
+    };
+
+    betting_event_visitor visitor{ queue, _get_matched_bet_game };
+
+    op.visit(visitor);
+}
+
+void betting_event_stream::flush(uint32_t block_num)
+{
+    if (!_open || (_events.empty() && _dropped == 0))
+        return;
+
+    betting_events_api_object msg;
+    msg.block_num = block_num;
+    msg.events = std::move(_events);
+    msg.dropped = _dropped;
+
+    _events.clear();
+    _dropped = 0;
+
+    try
+    {
+        _callback(fc::variant(msg));
+    }
+    catch (...)
+    {
+        // the session is gone, nothing is queued for it any more
+        _open = false;
+    }
+}
+
+bool betting_event_stream::is_subscribed(const uuid_type& game_uuid,
+                                         const account_name_type& better1,
+                                         const account_name_type& better2) const
+{
+    if (_filter.games.empty() && _filter.betters.empty())
+        return true;
+
+    return _filter.games.count(game_uuid) || _filter.betters.count(better1)
+        || (better2 != account_name_type() && _filter.betters.count(better2));
+}
+
+} // namespace app
+} // namespace scorum
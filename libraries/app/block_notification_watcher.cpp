@@ -0,0 +1,62 @@
+#include <scorum/app/block_notification_watcher.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/log/logger.hpp>
+
+namespace scorum {
+namespace app {
+
+block_notification_watcher::block_notification_watcher(const chainbase::block_notifier& notifier,
+                                                       handler_type handler,
+                                                       std::chrono::microseconds wait_timeout)
+    : _notifier(notifier)
+    , _handler(std::move(handler))
+    , _wait_timeout(wait_timeout)
+{
+    FC_ASSERT(_notifier.valid(), "shared memory file has no block notification state");
+    FC_ASSERT(_handler);
+
+    _thread = std::thread([this]() { run(); });
+}
+
+block_notification_watcher::~block_notification_watcher()
+{
+    stop();
+}
+
+void block_notification_watcher::stop()
+{
+    _stopped = true;
+    if (_thread.joinable())
+        _thread.join();
+}
+
+void block_notification_watcher::run()
+{
+    // blocks announced before we started are already in the mapped state
+    uint32_t last_sequence = _notifier.read().sequence;
+
+    while (!_stopped)
+    {
+        auto notification = _notifier.wait(last_sequence, _wait_timeout);
+        if (notification.sequence == last_sequence || _stopped)
+            continue;
+
+        last_sequence = notification.sequence;
+
+        try
+        {
+            _handler(notification);
+        }
+        catch (const fc::exception& e)
+        {
+            elog("block notification handler failed: ${e}", ("e", e.to_detail_string()));
+        }
+        catch (const std::exception& e)
+        {
+            elog("block notification handler failed: ${e}", ("e", e.what()));
+        }
+    }
+}
+}
+}
@@ -21,6 +21,7 @@ using namespace scorum::chain;
 
 chain_api::chain_api(const api_context& ctx)
     : _db(*ctx.app.chain_database())
+    , _cache(ctx.app.get_api_response_cache())
 {
 }
 
@@ -29,6 +30,11 @@ void chain_api::on_api_startup()
 }
 
 chain_properties_api_obj chain_api::get_chain_properties() const
+{
+    return _cache.get(API_CHAIN, "get_chain_properties", [&]() { return get_chain_properties_impl(); });
+}
+
+chain_properties_api_obj chain_api::get_chain_properties_impl() const
 {
     return _db.with_read_lock([&]() {
 
@@ -145,6 +145,7 @@ public:
     std::function<void(const fc::variant&)> _block_applied_callback;
 
     scorum::chain::database& _db;
+    api_response_cache& _cache;
 
     boost::signals2::scoped_connection _block_applied_connection;
 
@@ -199,6 +200,7 @@ database_api::~database_api()
 
 database_api_impl::database_api_impl(const scorum::app::api_context& ctx)
     : _db(*ctx.app.chain_database())
+    , _cache(ctx.app.get_api_response_cache())
 {
     wlog("creating database api ${x}", ("x", int64_t(this)));
 }
@@ -230,7 +232,9 @@ fc::variant_object database_api_impl::get_config() const
 
 dynamic_global_property_api_obj database_api::get_dynamic_global_properties() const
 {
-    return my->_db.with_read_lock([&]() { return my->get_dynamic_global_properties(); });
+    return my->_cache.get(API_DATABASE, "get_dynamic_global_properties", [&]() {
+        return my->_db.with_read_lock([&]() { return my->get_dynamic_global_properties(); });
+    });
 }
 
 dynamic_global_property_api_obj database_api_impl::get_dynamic_global_properties() const
@@ -302,7 +306,8 @@ std::vector<std::set<std::string>> database_api_impl::get_key_references(std::ve
 
 std::vector<extended_account> database_api::get_accounts(const std::vector<std::string>& names) const
 {
-    return my->_db.with_read_lock([&]() { return my->get_accounts(names); });
+    return my->_cache.get(API_DATABASE, "get_accounts",
+                          [&]() { return my->_db.with_read_lock([&]() { return my->get_accounts(names); }); }, names);
 }
 
 std::vector<extended_account> database_api_impl::get_accounts(const std::vector<std::string>& names) const
@@ -147,7 +147,8 @@ public:
     void add_node(const fc::ip::endpoint& ep);
 
     /**
-     * @brief Get status of all current connections to peers
+     * @brief Get status of all current connections to peers, the "transactions" field of the info holds the
+     *        accepted, rejected and dropped transactions received from the peer
      */
     std::vector<graphene::net::peer_status> get_connected_peers() const;
 
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <fc/io/json.hpp>
+#include <fc/reflect/reflect.hpp>
+#include <fc/variant.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Results of read API calls shared by all API sessions.
+ *
+ * Entries are keyed by API, method and parameters and are dropped every time a block is applied or popped, so a
+ * cached result is the one computed against the current head block. Pending transactions don't drop entries, so a
+ * cached result may miss their changes until the next block. Only configured methods are cached, a method TTL
+ * additionally limits the life of its entries within one block. The oldest entries are evicted when the cache is
+ * full.
+ */
+class api_response_cache
+{
+public:
+    struct method_config
+    {
+        /// 0 keeps entries until the next block
+        uint32_t ttl_ms = 0;
+    };
+
+    struct stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t size = 0;
+    };
+
+    /// by "<api>.<method>"
+    using stats_map = std::map<std::string, stats>;
+
+    explicit api_response_cache(size_t max_size = 0);
+
+    /// 0 disables the cache
+    void set_max_size(size_t max_size);
+
+    /// method is "<api>.<method>"
+    void enable_method(const std::string& method, const method_config& config = method_config());
+
+    /**
+     * Returns the cached result of the method called with the parameters or calls compute and caches its result.
+     * compute must not depend on anything but the chain state and the parameters.
+     */
+    template <typename Compute, typename... Params>
+    auto get(const std::string& api, const std::string& method, Compute&& compute, const Params&... params)
+        -> typename std::decay<decltype(compute())>::type
+    {
+        using result_type = typename std::decay<decltype(compute())>::type;
+
+        std::string name = api + "." + method;
+
+        uint64_t generation = 0;
+        if (!begin_lookup(name, generation))
+            return compute();
+
+        std::string key = name + fc::json::to_string(fc::variants{ fc::variant(params)... });
+
+        auto cached = find(name, key);
+        if (cached)
+            return *std::static_pointer_cast<const result_type>(cached);
+
+        auto result = std::make_shared<const result_type>(compute());
+        insert(name, key, result, generation);
+
+        return *result;
+    }
+
+    /// drops all entries, called on applied and popped blocks
+    void invalidate();
+
+    stats_map get_stats() const;
+
+private:
+    struct entry
+    {
+        std::string method;
+        std::shared_ptr<const void> value;
+        std::chrono::steady_clock::time_point expires;
+        bool with_ttl = false;
+    };
+
+    bool begin_lookup(const std::string& method, uint64_t& generation) const;
+    std::shared_ptr<const void> find(const std::string& method, const std::string& key);
+    void insert(const std::string& method,
+                const std::string& key,
+                std::shared_ptr<const void> value,
+                uint64_t generation);
+    void erase(const std::string& key);
+
+    mutable std::mutex _mutex;
+
+    size_t _max_size;
+    uint64_t _generation = 0;
+
+    std::map<std::string, method_config> _methods;
+    std::unordered_map<std::string, entry> _entries;
+    std::deque<std::string> _order;
+
+    std::map<std::string, stats> _stats;
+};
+}
+}
+
+FC_REFLECT(scorum::app::api_response_cache::stats, (hits)(misses)(size))
@@ -25,6 +25,8 @@
 
 #include <scorum/app/api_access.hpp>
 #include <scorum/app/api_context.hpp>
+#include <scorum/app/api_response_cache.hpp>
+#include <scorum/app/transaction_prevalidator.hpp>
 #include <scorum/chain/database/database.hpp>
 
 #include <graphene/net/node.hpp>
@@ -150,6 +152,13 @@ public:
     std::shared_ptr<chain::database> chain_database() const;
     // std::shared_ptr<graphene::db::object_database> pending_trx_database() const;
 
+    /// results of read API calls shared by API sessions, invalidated by applied and popped blocks or, on read only
+    /// nodes, by blocks the write node announces
+    api_response_cache& get_api_response_cache() const;
+
+    /// counters of the checks of transactions received from the network, empty on read only nodes
+    transaction_prevalidator::stats get_transaction_prevalidation_stats() const;
+
     void set_block_production(bool producing_blocks);
     fc::optional<api_access_info> get_api_access_info(const std::string& username) const;
     void set_api_access_info(const std::string& username, api_access_info&& permissions);
@@ -183,6 +192,12 @@ public:
 
     void get_max_block_age(int32_t& result);
 
+    /**
+     * Emitted on read only nodes with the head block number every time the write node announces a block through the
+     * shared memory file. Blocks announced in a quick succession may be reported once with the last number.
+     */
+    boost::signals2::signal<void(uint32_t)> head_block_notified;
+
     fc::api<network_broadcast_api>& get_write_node_net_api();
 
     fc::optional<std::string> _remote_endpoint;
@@ -6,14 +6,20 @@
 
 #include <scorum/app/betting_api_objects.hpp>
 
+#include <boost/signals2/connection.hpp>
+
 namespace chainbase {
 class database_guard;
 }
 
 namespace scorum {
+namespace chain {
+class database;
+}
 namespace app {
 
 struct api_context;
+class betting_event_stream;
 
 /**
  * @brief Betting API
@@ -58,6 +64,21 @@ public:
      */
     std::vector<game_api_object> get_games_by_status(const fc::flat_set<chain::game_status>& filter) const;
 
+    /**
+     * @brief Returns games with the status which start within the time window, ordered by start time
+     * @param status game status
+     * @param start_from lower bound of the game start time
+     * @param start_to upper bound of the game start time
+     * @param from lower bound game id among games starting at start_from (used to continue paging)
+     * @param limit query limit
+     * @return array of game_api_object's
+     */
+    std::vector<game_api_object> lookup_games_by_status(chain::game_status status,
+                                                        fc::time_point_sec start_from,
+                                                        fc::time_point_sec start_to,
+                                                        chain::game_id_type from,
+                                                        uint32_t limit) const;
+
     /**
      * @brief Returns games
      * @param UUIDs of games to return
@@ -117,6 +138,22 @@ public:
      */
     std::vector<pending_bet_api_object> get_game_pending_bets(const uuid_type& uuid) const;
 
+    /**
+     * @brief Subscribes to betting events: matched, cancelled and resolved bets
+     *
+     * The callback receives a betting_events_api_object for each applied block which has events passing the filter.
+     * A session has one subscription, a new call replaces the previous one.
+     *
+     * @param cb callback
+     * @param filter games and betters to follow, empty filter follows all betting events
+     */
+    void set_betting_events_callback(std::function<void(const fc::variant&)> cb, const betting_events_filter& filter);
+
+    /**
+     * @brief Stops sending betting events to this session
+     */
+    void cancel_betting_events_callback();
+
     /**
      * @brief Return betting properties
      * @return betting propery api object
@@ -131,6 +168,12 @@ private:
     std::unique_ptr<impl> _impl;
 
     std::shared_ptr<chainbase::database_guard> _guard;
+    std::shared_ptr<chain::database> _db;
+
+    std::shared_ptr<betting_event_stream> _events;
+    boost::signals2::scoped_connection _pre_applied_block_connection;
+    boost::signals2::scoped_connection _post_apply_operation_connection;
+    boost::signals2::scoped_connection _applied_block_connection;
 };
 
 } // namespace app
@@ -140,6 +183,7 @@ private:
 FC_API(scorum::app::betting_api, (get_game_returns)
                                  (get_game_winners)
                                  (get_games_by_status)
+                                 (lookup_games_by_status)
                                  (get_games_by_uuids)
                                  (lookup_games_by_id)
                                  (lookup_matched_bets)
@@ -148,5 +192,7 @@ FC_API(scorum::app::betting_api, (get_game_returns)
                                  (get_pending_bets)
                                  (get_game_matched_bets)
                                  (get_game_pending_bets)
+                                 (set_betting_events_callback)
+                                 (cancel_betting_events_callback)
                                  (get_betting_properties))
 // clang-format on
@@ -96,12 +96,43 @@ public:
 
     std::vector<game_api_object> get_games_by_status(const fc::flat_set<game_status>& filter) const
     {
-        auto games = _game_dba.get_all_by<by_id>();
-        auto rng = games //
-            | boost::adaptors::filtered([&](const auto& obj) { return filter.find(obj.status) != filter.end(); })
-            | boost::adaptors::transformed([](const auto& obj) { return game_api_object(obj); });
+        using namespace boost::adaptors;
+
+        std::vector<game_api_object> result;
+
+        for (const auto& status : filter)
+        {
+            auto games = _game_dba.get_range_by<by_status_start_time>(status);
+            boost::push_back(result, games | transformed([](const auto& obj) { return game_api_object(obj); }));
+        }
+
+        // games are returned in creation order regardless of their status
+        boost::range::sort(result, [](const auto& l, const auto& r) { return l.id < r.id; });
+
+        return result;
+    }
+
+    std::vector<game_api_object> lookup_games_by_status(game_status status,
+                                                        fc::time_point_sec start_from,
+                                                        fc::time_point_sec start_to,
+                                                        game_id_type from,
+                                                        uint32_t limit) const
+    {
+        using namespace dba;
+        using namespace boost::adaptors;
+        using namespace utils::adaptors;
+
+        FC_ASSERT(limit <= _lookup_limit, "Limit should be le than LOOKUP_LIMIT",
+                  ("limit", limit)("LOOKUP_LIMIT", _lookup_limit));
 
-        return { rng.begin(), rng.end() };
+        auto games = _game_dba.get_range_by<by_status_start_time>(std::make_tuple(status, start_from, from) <= _x,
+                                                                  _x <= std::make_tuple(status, start_to));
+        auto result = games //
+            | take_n(limit) //
+            | transformed([](const auto& obj) { return game_api_object(obj); }) //
+            | collect<std::vector>();
+
+        return result;
     }
 
     std::vector<game_api_object> get_games_by_uuids(const std::vector<uuid_type>& uuids) const
@@ -201,6 +232,13 @@ public:
         return result;
     }
 
+    uuid_type get_matched_bet_game(int64_t matched_bet_id) const
+    {
+        const auto* bet = _matched_bet_dba.find_by<by_id>(matched_bet_id_type(matched_bet_id));
+
+        return bet ? bet->game_uuid : uuid_type();
+    }
+
     betting_property_api_object get_betting_properties() const
     {
         return _betting_prop_dba.get();
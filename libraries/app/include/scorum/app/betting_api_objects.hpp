@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scorum/protocol/types.hpp>
+#include <scorum/protocol/operations.hpp>
 #include <scorum/chain/schema/game_object.hpp>
 #include <scorum/chain/schema/bet_objects.hpp>
 #include <scorum/chain/schema/betting_property_object.hpp>
@@ -87,6 +88,40 @@ using matched_bet_api_object = api_obj<chain::matched_bet_object>;
 using pending_bet_api_object = api_obj<chain::pending_bet_object>;
 using betting_property_api_object = api_obj<chain::betting_property_object>;
 
+/**
+ * @brief Selects betting events sent to a subscriber. An event passes if its game or one of its betters is listed,
+ * empty filter passes all events.
+ */
+struct betting_events_filter
+{
+    fc::flat_set<uuid_type> games;
+    fc::flat_set<protocol::account_name_type> betters;
+};
+
+/**
+ * @brief bets_matched_operation, bet_cancelled_operation or bet_resolved_operation with its game
+ */
+struct betting_event_api_object
+{
+    uuid_type game_uuid;
+    protocol::operation op;
+};
+
+/**
+ * @brief Betting events of one applied block
+ */
+struct betting_events_api_object
+{
+    uint32_t block_num = 0;
+    std::vector<betting_event_api_object> events;
+
+    /**
+     * @brief Events of the block which didn't fit into the subscription queue, the subscriber should re-read
+     * its games with polling calls when it isn't 0
+     */
+    uint32_t dropped = 0;
+};
+
 } // namespace app
 } // namespace scorum
 
@@ -118,6 +153,10 @@ FC_REFLECT(scorum::app::winner_api_object,
           (income))
 // clang-format on
 
+FC_REFLECT(scorum::app::betting_events_filter, (games)(betters))
+FC_REFLECT(scorum::app::betting_event_api_object, (game_uuid)(op))
+FC_REFLECT(scorum::app::betting_events_api_object, (block_num)(events)(dropped))
+
 FC_REFLECT_DERIVED(scorum::app::matched_bet_api_object, (scorum::chain::matched_bet_object), BOOST_PP_SEQ_NIL)
 FC_REFLECT_DERIVED(scorum::app::pending_bet_api_object, (scorum::chain::pending_bet_object), BOOST_PP_SEQ_NIL)
 FC_REFLECT_DERIVED(scorum::app::betting_property_api_object, (scorum::chain::betting_property_object), BOOST_PP_SEQ_NIL)
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <scorum/app/betting_api_objects.hpp>
+
+#include <scorum/chain/operation_notification.hpp>
+#include <scorum/protocol/block.hpp>
+
+#include <fc/variant.hpp>
+
+#include <functional>
+#include <memory>
+
+#define BETTING_EVENTS_QUEUE_LIMIT 1000
+
+namespace scorum {
+namespace app {
+
+/**
+ * Betting events of one API session.
+ *
+ * Betting virtual operations of a block are filtered and queued while the block is applied and sent to the
+ * subscriber as one betting_events_api_object when the block is applied. Operations of pending transactions are
+ * not streamed. At most queue_limit events are sent per block, the rest is only counted, so a busy block can't
+ * make a session build an unbounded message. The stream stops once sending to the subscriber fails.
+ */
+class betting_event_stream : public std::enable_shared_from_this<betting_event_stream>
+{
+public:
+    using callback_type = std::function<void(const fc::variant&)>;
+    /// game of the matched bet, bets_matched_operation doesn't carry it
+    using matched_bet_game_getter = std::function<uuid_type(int64_t matched_bet_id)>;
+
+    betting_event_stream(callback_type callback,
+                         const betting_events_filter& filter,
+                         matched_bet_game_getter get_matched_bet_game,
+                         uint32_t queue_limit = BETTING_EVENTS_QUEUE_LIMIT);
+
+    void on_pre_applied_block(const protocol::signed_block& block);
+    void on_operation(const chain::operation_notification& note);
+    void on_applied_block(const protocol::signed_block& block);
+
+    /// false after the subscriber couldn't be reached
+    bool is_open() const
+    {
+        return _open;
+    }
+
+    void push(const protocol::operation& op);
+    void flush(uint32_t block_num);
+
+private:
+    bool is_subscribed(const uuid_type& game_uuid,
+                       const protocol::account_name_type& better1,
+                       const protocol::account_name_type& better2 = protocol::account_name_type()) const;
+
+    callback_type _callback;
+    betting_events_filter _filter;
+    matched_bet_game_getter _get_matched_bet_game;
+    const uint32_t _queue_limit;
+
+    bool _in_block = false;
+    bool _open = true;
+
+    std::vector<betting_event_api_object> _events;
+    uint32_t _dropped = 0;
+};
+
+} // namespace app
+} // namespace scorum
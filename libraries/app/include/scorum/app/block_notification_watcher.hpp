@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chainbase/block_notification.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace scorum {
+namespace app {
+
+/**
+ * Waits on its own thread for the blocks the writer process announces in the shared memory file and calls the
+ * handler once per announcement. Announcements made while the handler runs are merged into the next call, so the
+ * handler always sees the latest head block.
+ */
+class block_notification_watcher
+{
+public:
+    using handler_type = std::function<void(const chainbase::block_notification&)>;
+
+    /// the handler is called on the watcher thread
+    block_notification_watcher(const chainbase::block_notifier& notifier,
+                               handler_type handler,
+                               std::chrono::microseconds wait_timeout = std::chrono::milliseconds(200));
+    ~block_notification_watcher();
+
+    /// waits for the handler to return, at most wait_timeout for the thread to notice
+    void stop();
+
+private:
+    void run();
+
+    const chainbase::block_notifier _notifier;
+    const handler_type _handler;
+    const std::chrono::microseconds _wait_timeout;
+
+    std::atomic<bool> _stopped{ false };
+    std::thread _thread;
+};
+}
+}
@@ -15,6 +15,7 @@ class database;
 namespace app {
 
 struct api_context;
+class api_response_cache;
 
 enum class reward_fund_type
 {
@@ -43,7 +44,10 @@ public:
     chain_capital_api_obj get_chain_capital() const;
 
 private:
+    chain_properties_api_obj get_chain_properties_impl() const;
+
     chain::database& _db;
+    api_response_cache& _cache;
 };
 }
 }
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <scorum/chain/signature_cache.hpp>
+
+#include <scorum/protocol/transaction.hpp>
+
+#include <fc/reflect/reflect.hpp>
+#include <fc/thread/thread.hpp>
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace scorum {
+namespace app {
+
+using scorum::protocol::block_id_type;
+using scorum::protocol::chain_id_type;
+using scorum::protocol::signed_transaction;
+using scorum::protocol::transaction_id_type;
+
+/**
+ * Checks transactions received from the p2p network before they are pushed to the chain.
+ *
+ * The "stateless" stage checks the size, validates operations, checks the expiration window and the TaPoS reference
+ * against the last applied blocks and drops transactions which are already pushed or in progress. The "signatures"
+ * stage recovers signature keys into the signature cache, so the pushed transaction finds them there. Both stages
+ * run on the prevalidation threads without the database lock, only transactions passing them reach the "push"
+ * stage. Counters and durations are kept per stage, rejections are counted per reason.
+ */
+class transaction_prevalidator
+{
+public:
+    struct stage_stats
+    {
+        uint64_t passed = 0;
+        uint64_t rejected = 0;
+        uint64_t total_us = 0;
+        uint64_t max_us = 0;
+    };
+
+    struct stats
+    {
+        /// by stage: "stateless", "signatures", "push"
+        std::map<std::string, stage_stats> stages;
+
+        /// by reason: "too_large", "invalid", "expired", "expiration_too_far", "tapos", "duplicate", "signature",
+        /// "chain"
+        std::map<std::string, uint64_t> rejections;
+
+        uint64_t in_progress = 0;
+    };
+
+    /// what the stateless checks take from the chain, updated on every applied block
+    struct head_state
+    {
+        uint32_t block_num = 0;
+        block_id_type block_id;
+        fc::time_point_sec time;
+        uint32_t max_transaction_size = 0;
+    };
+
+    /// 0 threads runs the stages on the calling thread
+    transaction_prevalidator(chain::signature_cache& signature_cache, const chain_id_type& chain_id, uint32_t threads);
+
+    void set_head(const head_state& head);
+
+    /// a popped block can't be referenced by TaPoS any more
+    void forget_block(uint32_t block_num);
+
+    /**
+     * Runs the stages and calls push for the transaction which passed them. Throws if the transaction is rejected
+     * by a stage or by push.
+     */
+    void process(const signed_transaction& trx, const std::function<void(const signed_transaction&)>& push);
+
+    stats get_stats() const;
+
+private:
+    void check(const signed_transaction& trx, const transaction_id_type& id, const head_state& head);
+    void check_stateless(const signed_transaction& trx,
+                         const transaction_id_type& id,
+                         const head_state& head,
+                         std::string& reason);
+    bool is_tapos_valid(const signed_transaction& trx) const;
+
+    bool begin(const transaction_id_type& id);
+    void finish(const transaction_id_type& id, const fc::time_point_sec& expiration, bool pushed);
+
+    template <typename Stage> void run_stage(const std::string& name, Stage&& stage);
+    void record(const std::string& stage, const fc::microseconds& duration, const std::string& rejection);
+
+    chain::signature_cache& _signature_cache;
+    const chain_id_type _chain_id;
+
+    std::vector<std::unique_ptr<fc::thread>> _workers;
+    std::atomic<size_t> _next_worker{ 0 };
+
+    mutable std::mutex _mutex;
+
+    head_state _head;
+    /// ids of applied blocks by ref_block_num, like block_summary_object
+    std::vector<block_id_type> _recent_blocks;
+
+    std::set<transaction_id_type> _in_progress;
+    /// pushed transactions until they expire
+    std::map<transaction_id_type, fc::time_point_sec> _pushed;
+    std::multimap<fc::time_point_sec, transaction_id_type> _pushed_by_expiration;
+
+    stats _stats;
+};
+}
+}
+
+FC_REFLECT(scorum::app::transaction_prevalidator::stage_stats, (passed)(rejected)(total_us)(max_us))
+FC_REFLECT(scorum::app::transaction_prevalidator::stats, (stages)(rejections)(in_progress))
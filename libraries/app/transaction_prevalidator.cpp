@@ -0,0 +1,222 @@
+#include <scorum/app/transaction_prevalidator.hpp>
+
+#include <scorum/protocol/config.hpp>
+
+#include <fc/io/raw.hpp>
+
+namespace scorum {
+namespace app {
+
+transaction_prevalidator::transaction_prevalidator(chain::signature_cache& signature_cache,
+                                                   const chain_id_type& chain_id,
+                                                   uint32_t threads)
+    : _signature_cache(signature_cache)
+    , _chain_id(chain_id)
+    , _recent_blocks(0x10000)
+{
+    for (uint32_t i = 0; i < threads; ++i)
+        _workers.emplace_back(new fc::thread("trx_prevalidation_" + std::to_string(i)));
+}
+
+void transaction_prevalidator::set_head(const head_state& head)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _head = head;
+    _recent_blocks[head.block_num & 0xffff] = head.block_id;
+
+    // the chain drops expired transactions from its dupe check index as well
+    auto last = _pushed_by_expiration.upper_bound(head.time);
+    for (auto it = _pushed_by_expiration.begin(); it != last; ++it)
+        _pushed.erase(it->second);
+    _pushed_by_expiration.erase(_pushed_by_expiration.begin(), last);
+}
+
+void transaction_prevalidator::forget_block(uint32_t block_num)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _recent_blocks[block_num & 0xffff] = block_id_type();
+}
+
+template <typename Stage> void transaction_prevalidator::run_stage(const std::string& name, Stage&& stage)
+{
+    auto started = fc::time_point::now();
+
+    std::string reason;
+    try
+    {
+        stage(reason);
+    }
+    catch (const fc::exception&)
+    {
+        record(name, fc::time_point::now() - started, reason);
+        throw;
+    }
+
+    record(name, fc::time_point::now() - started, std::string());
+}
+
+void transaction_prevalidator::process(const signed_transaction& trx,
+                                       const std::function<void(const signed_transaction&)>& push)
+{
+    auto id = trx.id();
+
+    head_state head;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        head = _head;
+    }
+
+    if (_workers.empty())
+    {
+        check(trx, id, head);
+    }
+    else
+    {
+        // the calling task yields while waiting, so transactions from other peers are checked meanwhile
+        _workers[_next_worker++ % _workers.size()]
+            ->async([&]() { check(trx, id, head); }, "prevalidate_transaction")
+            .wait();
+    }
+
+    try
+    {
+        run_stage("push", [&](std::string& reason) {
+            reason = "chain";
+            push(trx);
+        });
+    }
+    catch (...)
+    {
+        finish(id, trx.expiration, false);
+        throw;
+    }
+
+    finish(id, trx.expiration, true);
+}
+
+void transaction_prevalidator::check(const signed_transaction& trx,
+                                     const transaction_id_type& id,
+                                     const head_state& head)
+{
+    run_stage("stateless", [&](std::string& reason) { check_stateless(trx, id, head, reason); });
+
+    try
+    {
+        run_stage("signatures", [&](std::string& reason) {
+            reason = "signature";
+            _signature_cache.prefetch(trx, _chain_id);
+        });
+    }
+    catch (...)
+    {
+        finish(id, trx.expiration, false);
+        throw;
+    }
+}
+
+void transaction_prevalidator::check_stateless(const signed_transaction& trx,
+                                               const transaction_id_type& id,
+                                               const head_state& head,
+                                               std::string& reason)
+{
+    // the same checks as database::push_transaction and database::_apply_transaction do, against the head known
+    // when the transaction arrived
+
+    reason = "too_large";
+    size_t trx_size = fc::raw::pack_size(trx);
+    FC_ASSERT(head.max_transaction_size == 0 || trx_size <= head.max_transaction_size, "Transaction is too large",
+              ("size", trx_size)("max", head.max_transaction_size));
+
+    reason = "invalid";
+    trx.validate();
+
+    if (head.block_num > 0)
+    {
+        reason = "expired";
+        FC_ASSERT(head.time < trx.expiration, "Transaction is expired", ("now", head.time)("trx.exp", trx.expiration));
+
+        reason = "expiration_too_far";
+        FC_ASSERT(trx.expiration <= head.time + fc::seconds(SCORUM_MAX_TIME_UNTIL_EXPIRATION),
+                  "Transaction expiration is too far",
+                  ("trx.expiration", trx.expiration)("now", head.time)(
+                      "max_til_exp", SCORUM_MAX_TIME_UNTIL_EXPIRATION));
+
+        reason = "tapos";
+        FC_ASSERT(is_tapos_valid(trx), "Transaction doesn't reference a known block",
+                  ("ref_block_num", trx.ref_block_num)("ref_block_prefix", trx.ref_block_prefix));
+    }
+
+    reason = "duplicate";
+    FC_ASSERT(begin(id), "Duplicate transaction", ("trx_id", id));
+}
+
+bool transaction_prevalidator::is_tapos_valid(const signed_transaction& trx) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    const auto& block_id = _recent_blocks[trx.ref_block_num];
+
+    // blocks applied before the node start are unknown here, the chain checks them
+    return block_id == block_id_type() || trx.ref_block_prefix == block_id._hash[1];
+}
+
+bool transaction_prevalidator::begin(const transaction_id_type& id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_pushed.count(id))
+        return false;
+
+    if (!_in_progress.insert(id).second)
+        return false;
+
+    ++_stats.in_progress;
+    return true;
+}
+
+void transaction_prevalidator::finish(const transaction_id_type& id,
+                                      const fc::time_point_sec& expiration,
+                                      bool pushed)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_in_progress.erase(id))
+        --_stats.in_progress;
+
+    if (pushed && _pushed.emplace(id, expiration).second)
+        _pushed_by_expiration.emplace(expiration, id);
+}
+
+void transaction_prevalidator::record(const std::string& stage,
+                                      const fc::microseconds& duration,
+                                      const std::string& rejection)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto& stage_stats = _stats.stages[stage];
+
+    if (rejection.empty())
+    {
+        ++stage_stats.passed;
+    }
+    else
+    {
+        ++stage_stats.rejected;
+        ++_stats.rejections[rejection];
+    }
+
+    uint64_t us = std::max<int64_t>(duration.count(), 0);
+    stage_stats.total_us += us;
+    stage_stats.max_us = std::max(stage_stats.max_us, us);
+}
+
+transaction_prevalidator::stats transaction_prevalidator::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return _stats;
+}
+}
+}
@@ -0,0 +1,98 @@
+#include <scorum/chain/account_authority_cache.hpp>
+
+#include <scorum/chain/schema/account_objects.hpp>
+
+#include <chainbase/database_index.hpp>
+#include <chainbase/segment_manager.hpp>
+
+namespace scorum {
+namespace chain {
+
+account_authority_cache::account_authority_cache(size_t max_size)
+    : _max_size(max_size)
+{
+}
+
+const account_authority_cache::entry& account_authority_cache::get(const dba::db_index& db, const std::string& name)
+{
+    if (!_enabled)
+    {
+        _uncached = load(db, name);
+        return _uncached;
+    }
+
+    auto it = _entries.find(name);
+    if (it != _entries.end())
+    {
+        ++_hits;
+        return it->second;
+    }
+
+    ++_misses;
+
+    // popular accounts are requested again soon after, so the cache is simply restarted when full
+    if (_entries.size() >= _max_size)
+        _entries.clear();
+
+    return _entries.emplace(name, load(db, name)).first->second;
+}
+
+account_authority_cache::entry account_authority_cache::load(const dba::db_index& db, const std::string& name) const
+{
+    const auto& auth = db.get<account_authority_object, by_account>(name);
+
+    return { authority(auth.owner), authority(auth.active), authority(auth.posting) };
+}
+
+void account_authority_cache::on_changed(const account_name_type& name)
+{
+    const std::string key = name;
+
+    _entries.erase(key);
+    _changed.insert(key);
+}
+
+void account_authority_cache::on_undo()
+{
+    for (const auto& name : _changed)
+        _entries.erase(name);
+}
+
+void account_authority_cache::on_block_applied()
+{
+    _changed.clear();
+}
+
+void account_authority_cache::clear()
+{
+    _entries.clear();
+    _changed.clear();
+}
+
+void account_authority_cache::set_enabled(bool enabled)
+{
+    _enabled = enabled;
+    clear();
+}
+
+bool account_authority_cache::is_enabled() const
+{
+    return _enabled;
+}
+
+size_t account_authority_cache::size() const
+{
+    return _entries.size();
+}
+
+uint64_t account_authority_cache::hits() const
+{
+    return _hits;
+}
+
+uint64_t account_authority_cache::misses() const
+{
+    return _misses;
+}
+}
+}
@@ -37,7 +37,7 @@ std::vector<std::reference_wrapper<const pending_bet_object>> betting_matcher::m
         std::vector<std::reference_wrapper<const pending_bet_object>> bets_to_cancel;
 
         auto key = std::make_tuple(bet2.game_uuid, create_opposite(bet2.get_wincase()));
-        auto pending_bets = _pending_bet_dba.get_range_by<by_game_uuid_wincase>(key);
+        auto pending_bets = _pending_bet_dba.get_index_range_by<by_game_uuid_wincase>(key);
 
         for (const auto& bet1 : pending_bets)
         {
@@ -8,6 +8,8 @@
 #include <scorum/chain/dba/db_accessor.hpp>
 #include <scorum/chain/database/database_virtual_operations.hpp>
 
+#include <map>
+
 namespace scorum {
 namespace chain {
 betting_resolver::betting_resolver(account_service_i& account_svc,
@@ -25,7 +27,17 @@ betting_resolver::betting_resolver(account_service_i& account_svc,
 
 void betting_resolver::resolve_matched_bets(uuid_type game_uuid, const fc::flat_set<wincase_type>& results) const
 {
-    auto matched_bets = _matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+    auto matched_bets = _matched_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid);
+
+    // payouts are accumulated per better and applied after the walk, so each balance and the global
+    // betting stats are modified once per game instead of once per bet
+    std::map<account_name_type, asset> payouts;
+    asset resolved_volume(0, SCORUM_SYMBOL);
+
+    auto pay = [&](const account_name_type& better, const asset& amount) {
+        auto it = payouts.emplace(better, asset(0, amount.symbol())).first;
+        it->second += amount;
+    };
 
     for (const matched_bet_object& bet : matched_bets)
     {
@@ -35,7 +47,7 @@ void betting_resolver::resolve_matched_bets(uuid_type game_uuid, const fc::flat_
         if (fst_won)
         {
             auto income = bet.bet1_data.stake + bet.bet2_data.stake;
-            _account_svc.increase_balance(bet.bet1_data.better, income);
+            pay(bet.bet1_data.better, income);
 
             _virt_op_emitter.push_virtual_operation(bet_resolved_operation(
                 game_uuid, bet.bet1_data.better, bet.bet1_data.uuid, income, bet_resolve_kind::win));
@@ -43,15 +55,15 @@ void betting_resolver::resolve_matched_bets(uuid_type game_uuid, const fc::flat_
         else if (snd_won)
         {
             auto income = bet.bet1_data.stake + bet.bet2_data.stake;
-            _account_svc.increase_balance(bet.bet2_data.better, income);
+            pay(bet.bet2_data.better, income);
 
             _virt_op_emitter.push_virtual_operation(bet_resolved_operation(
                 game_uuid, bet.bet2_data.better, bet.bet2_data.uuid, income, bet_resolve_kind::win));
         }
         else
         {
-            _account_svc.increase_balance(bet.bet1_data.better, bet.bet1_data.stake);
-            _account_svc.increase_balance(bet.bet2_data.better, bet.bet2_data.stake);
+            pay(bet.bet1_data.better, bet.bet1_data.stake);
+            pay(bet.bet2_data.better, bet.bet2_data.stake);
 
             _virt_op_emitter.push_virtual_operation(bet_resolved_operation(
                 game_uuid, bet.bet1_data.better, bet.bet1_data.uuid, bet.bet1_data.stake, bet_resolve_kind::draw));
@@ -59,9 +71,18 @@ void betting_resolver::resolve_matched_bets(uuid_type game_uuid, const fc::flat_
                 game_uuid, bet.bet1_data.better, bet.bet1_data.uuid, bet.bet1_data.stake, bet_resolve_kind::draw));
         }
 
-        _dprop_dba.update([&](dynamic_global_property_object& o) {
-            o.betting_stats.matched_bets_volume -= bet.bet1_data.stake + bet.bet2_data.stake;
-        });
+        resolved_volume += bet.bet1_data.stake + bet.bet2_data.stake;
+    }
+
+    for (const auto& payout : payouts)
+    {
+        _account_svc.increase_balance(payout.first, payout.second);
+    }
+
+    if (!payouts.empty())
+    {
+        _dprop_dba.update(
+            [&](dynamic_global_property_object& o) { o.betting_stats.matched_bets_volume -= resolved_volume; });
     }
 
     _matched_bet_dba.remove_all(matched_bets);
@@ -87,10 +87,10 @@ const pending_bet_object& betting_service::create_pending_bet(const account_name
 
 void betting_service::cancel_game(uuid_type game_uuid)
 {
-    auto matched_bets = _matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+    auto matched_bets = _matched_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid);
     FC_ASSERT(matched_bets.empty(), "Cannot cancel game which has associated bets");
 
-    auto pending_bets = _matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+    auto pending_bets = _matched_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid);
     FC_ASSERT(pending_bets.empty(), "Cannot cancel game which has associated bets");
 
     const auto& game = _game_dba.get_by<by_uuid>(game_uuid);
@@ -142,14 +142,14 @@ void betting_service::cancel_bets(uuid_type game_uuid, const fc::flat_set<market
     };
     // clang-format on
 
-    auto pending_bets = _pending_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+    auto pending_bets = _pending_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid);
 
     std::vector<std::reference_wrapper<const pending_bet_object>> filtered_pending_bets;
     boost::set_intersection(pending_bets, cancelled_markets, std::back_inserter(filtered_pending_bets), less{});
 
     cancel_pending_bets(utils::unwrap_ref_wrapper(filtered_pending_bets));
 
-    auto matched_bets = _matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+    auto matched_bets = _matched_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid);
 
     std::vector<std::reference_wrapper<const matched_bet_object>> filtered_matched_bets;
     boost::set_intersection(matched_bets, cancelled_markets, std::back_inserter(filtered_matched_bets), less{});
@@ -190,6 +190,11 @@ fc::path block_log::block_log_index_path(const fc::path& file)
 }
 
 uint64_t block_log::append(const signed_block& b)
+{
+    return append(b, fc::raw::pack(b), b.id());
+}
+
+uint64_t block_log::append(const signed_block& b, const std::vector<char>& data, const block_id_type& id)
 {
     try
     {
@@ -202,12 +207,11 @@ uint64_t block_log::append(const signed_block& b)
                   "Append to index file occuring at wrong position.",
                   ("position", (uint64_t)my->index_stream.tellp())("expected",
                                                                    ((uint64_t)b.block_num() - 1) * sizeof(uint64_t)));
-        auto data = fc::raw::pack(b);
         my->block_stream.write(data.data(), data.size());
         my->block_stream.write((char*)&pos, sizeof(pos));
         my->index_stream.write((char*)&pos, sizeof(pos));
         my->head = b;
-        my->head_id = b.id();
+        my->head_id = id;
 
         return pos;
     }
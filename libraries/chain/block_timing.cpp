@@ -0,0 +1,58 @@
+#include <scorum/chain/block_timing.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace scorum {
+namespace chain {
+
+block_timing::block_timing(size_t window)
+    : _window(window)
+{
+}
+
+void block_timing::add(const std::string& name, uint32_t microseconds)
+{
+    auto it = _samples.find(name);
+    if (it == _samples.end())
+        it = _samples.emplace(name, samples(_window)).first;
+
+    ++it->second.count;
+    it->second.last.push_back(microseconds);
+}
+
+block_timing::stats_map block_timing::get_stats() const
+{
+    stats_map result;
+
+    for (const auto& named : _samples)
+    {
+        const samples& s = named.second;
+        if (s.last.empty())
+            continue;
+
+        std::vector<uint32_t> sorted(s.last.begin(), s.last.end());
+        std::sort(sorted.begin(), sorted.end());
+
+        auto percentile = [&](size_t p) { return sorted[(sorted.size() - 1) * p / 100]; };
+
+        stats& st = result[named.first];
+        st.count = s.count;
+        st.last = s.last.back();
+        st.mean = (uint32_t)(std::accumulate(sorted.begin(), sorted.end(), uint64_t(0)) / sorted.size());
+        st.p50 = percentile(50);
+        st.p90 = percentile(90);
+        st.p99 = percentile(99);
+        st.max = sorted.back();
+    }
+
+    return result;
+}
+
+void block_timing::clear()
+{
+    _samples.clear();
+}
+}
+}
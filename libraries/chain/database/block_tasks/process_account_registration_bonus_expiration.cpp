@@ -26,6 +26,8 @@ void process_account_registration_bonus_expiration::on_apply(block_task_context&
         account_registration_bonus_service.remove(account);
     }
 
+    ctx.count_expired(expiration_type::account_registration_bonus, accounts.size());
+
     debug_log(ctx.get_block_info(), "process_account_registration_bonus_expiration END");
 }
 
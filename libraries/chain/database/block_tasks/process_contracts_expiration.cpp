@@ -16,30 +16,30 @@ void process_contracts_expiration::on_apply(block_task_context& ctx)
     atomicswap_service_i& atomicswap_service = services.atomicswap_service();
     dynamic_global_property_service_i& dyn_prop_service = services.dynamic_global_property_service();
 
-    auto contracts = atomicswap_service.get_contracts();
     const auto& props = dyn_prop_service.get();
 
+    auto contracts = atomicswap_service.get_expired_contracts(props.time);
+
     for (const atomicswap_contract_object& contract : contracts)
     {
-        if (props.time >= contract.deadline)
+        if (contract.secret.empty())
+        {
+            auto owner = contract.owner;
+            auto refund_amount = contract.amount;
+
+            // only for initiator or not redeemed participant contracts
+            atomicswap_service.refund_contract(contract);
+
+            ctx.push_virtual_operation(expired_contract_refund_operation(owner, refund_amount));
+        }
+        else
         {
-            if (contract.secret.empty())
-            {
-                auto owner = contract.owner;
-                auto refund_amount = contract.amount;
-
-                // only for initiator or not redeemed participant contracts
-                atomicswap_service.refund_contract(contract);
-
-                ctx.push_virtual_operation(expired_contract_refund_operation(owner, refund_amount));
-            }
-            else
-            {
-                atomicswap_service.remove(contract);
-            }
+            atomicswap_service.remove(contract);
         }
     }
 
+    ctx.count_expired(expiration_type::atomicswap_contract, contracts.size());
+
     debug_log(ctx.get_block_info(), "process_contracts_expiration END");
 }
 }
@@ -192,19 +192,20 @@ void process_funds::distribute_active_sp_holders_reward(const asset& reward)
 
     asset distributed_reward = asset(0, reward.symbol());
 
-    auto active_sp_holders_array = _account_service.get_active_sp_holders();
-    if (!active_sp_holders_array.empty())
+    // paying rewards doesn't touch voting_power_restoring_time, so the index is walked in place
+    auto active_sp_holders = _account_service.get_active_sp_holders();
+    if (!active_sp_holders.empty())
     {
         // distribute
-        asset total_sp = std::accumulate(active_sp_holders_array.begin(), active_sp_holders_array.end(),
-                                         asset(0, SP_SYMBOL), [&](asset& accumulator, const account_object& account) {
+        asset total_sp = std::accumulate(active_sp_holders.begin(), active_sp_holders.end(), asset(0, SP_SYMBOL),
+                                         [&](asset& accumulator, const account_object& account) {
                                              return accumulator += account.vote_reward_competitive_sp;
                                          });
 
         if (total_sp.amount > 0)
         {
             active_sp_holders_reward_legacy_operation::rewarded_type rewarded;
-            for (const account_object& account : active_sp_holders_array)
+            for (const account_object& account : active_sp_holders)
             {
                 // It is used SP balance amount of account to calculate reward either in SP or SCR tokens
                 asset account_reward
@@ -6,6 +6,7 @@
 
 #include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/core/ignore_unused.hpp>
+#include <boost/scope_exit.hpp>
 
 #include <fc/smart_ref_impl.hpp>
 #include <fc/uint128.hpp>
@@ -228,6 +229,7 @@ void database::open(const fc::path& data_dir,
             // Rewind all undo state. This should return us to the state at the last irreversible block.
             with_write_lock([&]() {
                 for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo_all(); });
+                _account_authority_cache.clear();
 
                 for_each_index([&](chainbase::abstract_generic_index_i& item) {
                     FC_ASSERT(item.revision() == head_block_num(),
@@ -362,6 +364,9 @@ void database::close()
         _block_log.close();
 
         _fork_db.reset();
+
+        _account_authority_cache.clear();
+        _signature_cache.clear();
     }
     FC_CAPTURE_AND_RETHROW()
 }
@@ -460,6 +465,25 @@ optional<signed_block> database::fetch_block_by_id(const block_id_type& id) cons
     FC_CAPTURE_AND_RETHROW()
 }
 
+optional<std::vector<char>> database::fetch_packed_block_by_id(const block_id_type& id) const
+{
+    try
+    {
+        auto b = _fork_db.fetch_block(id);
+        if (b)
+            return b->packed_data();
+
+        optional<std::vector<char>> result;
+
+        auto tmp = _block_log.read_block_by_num(protocol::block_header::num_from_id(id));
+        if (tmp && tmp->id() == id)
+            result = fc::raw::pack(*tmp);
+
+        return result;
+    }
+    FC_CAPTURE_AND_RETHROW()
+}
+
 optional<signed_block> database::fetch_block_by_number(uint32_t block_num) const
 {
     try
@@ -574,6 +598,14 @@ bool database::push_block(const signed_block& new_block, uint32_t skip)
     bool result;
     detail::with_skip_flags(*this, skip, [&]() {
         with_write_lock([&]() {
+            // wakes read-only processes sharing the state file, we are the single writer under the lock,
+            // a failed fork switch changes the state too
+            BOOST_SCOPE_EXIT(this_)
+            {
+                this_->get_block_notifier().notify(this_->head_block_num());
+            }
+            BOOST_SCOPE_EXIT_END
+
             detail::without_pending_transactions(*this, std::move(_pending_tx), [&]() {
                 try
                 {
@@ -637,13 +669,13 @@ bool database::_push_block(const signed_block& new_block)
 
                 // If the newly pushed block is the same height as head, we get head back in new_head
                 // Only switch forks if new_head is actually higher than head
-                if (new_head->data.block_num() > head_block_num())
+                if (new_head->num > head_block_num())
                 {
                     debug_log(ctx, "current nead block_num=${h_num}", ("h_num", head_block_num()));
-                    debug_log(ctx, "new head block number=${f_num}", ("f_num", new_head->data.block_num()));
+                    debug_log(ctx, "new head block number=${f_num}", ("f_num", new_head->num));
                     debug_log(ctx, "switching to fork with block=${b}", ("b", (std::string)block_info(new_head->data)));
 
-                    auto branches = _fork_db.fetch_branch_from(new_head->data.id(), head_block_id());
+                    auto branches = _fork_db.fetch_branch_from(new_head->id, head_block_id());
 
                     // pop blocks until we hit the forked block
                     while (head_block_id() != branches.second.back()->data.previous)
@@ -678,7 +710,7 @@ bool database::_push_block(const signed_block& new_block)
                             {
                                 debug_log(ctx, "removing_block=${b} from fork",
                                           ("b", (std::string)block_info((*ritr)->data)));
-                                _fork_db.remove((*ritr)->data.id());
+                                _fork_db.remove((*ritr)->id);
                                 ++ritr;
                             }
                             _fork_db.set_head(branches.second.front());
@@ -781,6 +813,7 @@ void database::_push_transaction(const signed_transaction& trx)
     auto temp_session = start_undo_session();
     _apply_transaction(trx);
     _pending_tx.push_back(trx);
+    ++_pending_tx_generation;
 
     // The transaction applied successfully. Merge its changes into the pending block session.
     for_each_index([&](chainbase::abstract_generic_index_i& item) { item.squash(); });
@@ -813,6 +846,120 @@ signed_block database::generate_block(fc::time_point_sec when,
     return result;
 }
 
+std::vector<signed_transaction>
+database::_apply_pending_transactions_for_block(fc::time_point_sec when,
+                                                const std::vector<signed_transaction>& pending,
+                                                std::vector<signed_transaction>* skipped)
+{
+    static const size_t max_block_header_size = fc::raw::pack_size(signed_block_header()) + 4;
+    auto maximum_block_size = obtain_service<dbs_dynamic_global_property>()
+                                  .get()
+                                  .median_chain_props.maximum_block_size; // SCORUM_MAX_BLOCK_SIZE;
+    size_t total_block_size = max_block_header_size;
+
+    std::vector<signed_transaction> result;
+
+    uint64_t postponed_tx_count = 0;
+    for (const signed_transaction& tx : pending)
+    {
+        // Only include transactions that have not expired yet for currently generating block,
+        // this should clear problem transactions and allow block production to continue
+
+        if (tx.expiration < when)
+        {
+            if (skipped)
+                skipped->push_back(tx);
+            continue;
+        }
+
+        uint64_t new_total_size = total_block_size + fc::raw::pack_size(tx);
+
+        // postpone transaction if it would make block too big
+        if (new_total_size >= maximum_block_size)
+        {
+            postponed_tx_count++;
+            if (skipped)
+                skipped->push_back(tx);
+            continue;
+        }
+
+        try
+        {
+            auto temp_session = start_undo_session();
+            _apply_transaction(tx);
+            for_each_index([&](chainbase::abstract_generic_index_i& item) { item.squash(); });
+            temp_session->push();
+
+            total_block_size += fc::raw::pack_size(tx);
+            result.push_back(tx);
+        }
+        catch (const fc::exception& e)
+        {
+            // Do nothing, transaction will not be re-applied
+            // wlog( "Transaction was not processed while generating block due to ${e}", ("e", e) );
+            // wlog( "The transaction was ${t}", ("t", tx) );
+        }
+    }
+    if (postponed_tx_count > 0)
+    {
+        wlog("Postponed ${n} transactions due to block size limit", ("n", postponed_tx_count));
+    }
+
+    return result;
+}
+
+void database::prepare_block_candidate(fc::time_point_sec when, uint32_t skip)
+{
+    block_info ctx(when, "?");
+
+    debug_log(ctx, "prepare_block_candidate");
+
+    detail::with_skip_flags(*this, skip, [&]() {
+        with_write_lock([&]() {
+            block_candidate candidate;
+            candidate.previous = head_block_id();
+            candidate.timestamp = when;
+
+            // The pending state is rebuilt over the head block in a single pass. Transactions selected for the
+            // slot are applied first, so their changes are the pending state as well, the rest stay pending for
+            // later blocks. Transactions which no longer apply are culled like after a block.
+            std::vector<signed_transaction> pending = std::move(_pending_tx);
+            clear_pending();
+            _pending_tx_session = start_undo_session();
+
+            std::vector<signed_transaction> skipped;
+            candidate.transactions = _apply_pending_transactions_for_block(when, pending, &skipped);
+            _pending_tx = candidate.transactions;
+            ++_pending_tx_generation;
+
+            for (const signed_transaction& tx : skipped)
+            {
+                try
+                {
+                    _push_transaction(tx);
+                }
+                catch (const fc::exception&)
+                {
+                }
+            }
+
+            candidate.pending_tx_generation = _pending_tx_generation;
+            _block_candidate = std::move(candidate);
+        });
+    });
+}
+
+bool database::has_block_candidate(fc::time_point_sec when) const
+{
+    return _block_candidate.valid() && _block_candidate->previous == head_block_id()
+        && _block_candidate->timestamp == when;
+}
+
+bool database::is_block_candidate_actual(fc::time_point_sec when) const
+{
+    return has_block_candidate(when) && _block_candidate->pending_tx_generation == _pending_tx_generation;
+}
+
 signed_block database::_generate_block(fc::time_point_sec when,
                                        const account_name_type& witness_owner,
                                        const fc::ecc::private_key& block_signing_private_key)
@@ -836,74 +983,38 @@ signed_block database::_generate_block(fc::time_point_sec when,
         FC_ASSERT(witness_obj.signing_key == block_signing_private_key.get_public_key());
     }
 
-    static const size_t max_block_header_size = fc::raw::pack_size(signed_block_header()) + 4;
-    auto maximum_block_size = obtain_service<dbs_dynamic_global_property>()
-                                  .get()
-                                  .median_chain_props.maximum_block_size; // SCORUM_MAX_BLOCK_SIZE;
-    size_t total_block_size = max_block_header_size;
-
     signed_block pending_block;
 
-    with_write_lock([&]() {
-        //
-        // The following code throws away existing pending_tx_session and
-        // rebuilds it by re-applying pending transactions.
-        //
-        // This rebuild is necessary because pending transactions' validity
-        // and semantics may have changed since they were received, because
-        // time-based semantics are evaluated based on the current block
-        // time.  These changes can only be reflected in the database when
-        // the value of the "when" variable is known, which means we need to
-        // re-apply pending transactions in this method.
-        //
-        _pending_tx_session.reset();
-        _pending_tx_session = start_undo_session();
-
-        uint64_t postponed_tx_count = 0;
-        // pop pending state (reset to head block state)
-        for (const signed_transaction& tx : _pending_tx)
-        {
-            // Only include transactions that have not expired yet for currently generating block,
-            // this should clear problem transactions and allow block production to continue
-
-            if (tx.expiration < when)
-            {
-                continue;
-            }
-
-            uint64_t new_total_size = total_block_size + fc::raw::pack_size(tx);
-
-            // postpone transaction if it would make block too big
-            if (new_total_size >= maximum_block_size)
-            {
-                postponed_tx_count++;
-                continue;
-            }
-
-            try
-            {
-                auto temp_session = start_undo_session();
-                _apply_transaction(tx);
-                for_each_index([&](chainbase::abstract_generic_index_i& item) { item.squash(); });
-                temp_session->push();
+    if (has_block_candidate(when))
+    {
+        debug_log(ctx, "use block candidate");
 
-                total_block_size += fc::raw::pack_size(tx);
-                pending_block.transactions.push_back(tx);
-            }
-            catch (const fc::exception& e)
-            {
-                // Do nothing, transaction will not be re-applied
-                // wlog( "Transaction was not processed while generating block due to ${e}", ("e", e) );
-                // wlog( "The transaction was ${t}", ("t", tx) );
-            }
-        }
-        if (postponed_tx_count > 0)
-        {
-            wlog("Postponed ${n} transactions due to block size limit", ("n", postponed_tx_count));
-        }
+        pending_block.transactions = std::move(_block_candidate->transactions);
+    }
+    else
+    {
+        with_write_lock([&]() {
+            //
+            // The following code throws away existing pending_tx_session and
+            // rebuilds it by re-applying pending transactions.
+            //
+            // This rebuild is necessary because pending transactions' validity
+            // and semantics may have changed since they were received, because
+            // time-based semantics are evaluated based on the current block
+            // time.  These changes can only be reflected in the database when
+            // the value of the "when" variable is known, which means we need to
+            // re-apply pending transactions in this method.
+            //
+            _pending_tx_session.reset();
+            _pending_tx_session = start_undo_session();
+
+            pending_block.transactions = _apply_pending_transactions_for_block(when, _pending_tx);
+
+            _pending_tx_session.reset();
+        });
+    }
 
-        _pending_tx_session.reset();
-    });
+    _block_candidate.reset();
 
     // We have temporarily broken the invariant that
     // _pending_tx_session is the result of applying _pending_tx, as
@@ -991,8 +1102,12 @@ void database::pop_block()
 
         for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo(); });
 
+        _account_authority_cache.clear();
+
         _popped_tx.insert(_popped_tx.begin(), head_block->transactions.begin(), head_block->transactions.end());
 
+        notify_popped_block(*head_block);
+
         debug_log(ctx, "pop_block result");
     }
     FC_CAPTURE_AND_RETHROW(((std::string)ctx))
@@ -1004,7 +1119,9 @@ void database::clear_pending()
     {
         assert((_pending_tx.size() == 0) || _pending_tx_session.valid());
         _pending_tx.clear();
+        ++_pending_tx_generation;
         _pending_tx_session.reset();
+        _block_candidate.reset();
     }
     FC_CAPTURE_AND_RETHROW()
 }
@@ -1061,6 +1178,11 @@ void database::notify_applied_block(const signed_block& block)
     SCORUM_TRY_NOTIFY(applied_block, block)
 }
 
+void database::notify_popped_block(const signed_block& block)
+{
+    SCORUM_TRY_NOTIFY(popped_block, block)
+}
+
 void database::notify_on_pending_transaction(const signed_transaction& tx)
 {
     SCORUM_TRY_NOTIFY(on_pending_transaction, tx)
@@ -1124,60 +1246,77 @@ uint32_t database::get_slot_at_time(fc::time_point_sec when) const
 
 void database::account_recovery_processing()
 {
+    const auto now = head_block_time();
+
     // Clear expired recovery requests
     const auto& rec_req_idx = get_index<account_recovery_request_index>().indices().get<by_expiration>();
-    auto rec_req = rec_req_idx.begin();
 
-    while (rec_req != rec_req_idx.end() && rec_req->expires <= head_block_time())
-    {
-        remove(*rec_req);
-        rec_req = rec_req_idx.begin();
-    }
+    _expiration_scheduler.expire(expiration_type::account_recovery_request,
+                                 [&]() -> const account_recovery_request_object* {
+                                     auto rec_req = rec_req_idx.begin();
+                                     return rec_req != rec_req_idx.end() && rec_req->expires <= now ? &*rec_req
+                                                                                                    : nullptr;
+                                 },
+                                 [&](const account_recovery_request_object& rec_req) { remove(rec_req); });
 
     // Clear invalid historical authorities
     const auto& hist_idx = get_index<owner_authority_history_index>().indices(); // by id
-    auto hist = hist_idx.begin();
 
-    while (hist != hist_idx.end()
-           && time_point_sec(hist->last_valid_time + SCORUM_OWNER_AUTH_RECOVERY_PERIOD) < head_block_time())
-    {
-        remove(*hist);
-        hist = hist_idx.begin();
-    }
+    _expiration_scheduler.expire(
+        expiration_type::owner_authority_history,
+        [&]() -> const owner_authority_history_object* {
+            auto hist = hist_idx.begin();
+            return hist != hist_idx.end()
+                    && time_point_sec(hist->last_valid_time + SCORUM_OWNER_AUTH_RECOVERY_PERIOD) < now
+                ? &*hist
+                : nullptr;
+        },
+        [&](const owner_authority_history_object& hist) { remove(hist); });
 
     // Apply effective recovery_account changes
     const auto& change_req_idx = get_index<change_recovery_account_request_index>().indices().get<by_effective_date>();
-    auto change_req = change_req_idx.begin();
 
     auto& account_svc = account_service();
-    while (change_req != change_req_idx.end() && change_req->effective_on <= head_block_time())
-    {
-        modify(account_svc.get_account(change_req->account_to_recover),
-               [&](account_object& a) { a.recovery_account = change_req->recovery_account; });
-
-        remove(*change_req);
-        change_req = change_req_idx.begin();
-    }
+    _expiration_scheduler.expire(expiration_type::change_recovery_account_request,
+                                 [&]() -> const change_recovery_account_request_object* {
+                                     auto change_req = change_req_idx.begin();
+                                     return change_req != change_req_idx.end() && change_req->effective_on <= now
+                                         ? &*change_req
+                                         : nullptr;
+                                 },
+                                 [&](const change_recovery_account_request_object& change_req) {
+                                     modify(account_svc.get_account(change_req.account_to_recover),
+                                            [&](account_object& a) {
+                                                a.recovery_account = change_req.recovery_account;
+                                            });
+
+                                     remove(change_req);
+                                 });
 }
 
 void database::expire_escrow_ratification()
 {
+    const auto now = head_block_time();
     const auto& escrow_idx = get_index<escrow_index>().indices().get<by_ratification_deadline>();
-    auto escrow_itr = escrow_idx.lower_bound(false);
 
     auto& account_svc = account_service();
 
-    while (escrow_itr != escrow_idx.end() && !escrow_itr->is_approved()
-           && escrow_itr->ratification_deadline <= head_block_time())
-    {
-        const auto& old_escrow = *escrow_itr;
-        ++escrow_itr;
-
-        const auto& from_account = account_svc.get_account(old_escrow.from);
-        account_svc.increase_balance(from_account, old_escrow.scorum_balance + old_escrow.pending_fee);
+    _expiration_scheduler.expire(expiration_type::escrow_ratification,
+                                 [&]() -> const escrow_object* {
+                                     // not approved escrows go first
+                                     auto escrow_itr = escrow_idx.lower_bound(false);
+                                     return escrow_itr != escrow_idx.end() && !escrow_itr->is_approved()
+                                             && escrow_itr->ratification_deadline <= now
+                                         ? &*escrow_itr
+                                         : nullptr;
+                                 },
+                                 [&](const escrow_object& old_escrow) {
+                                     const auto& from_account = account_svc.get_account(old_escrow.from);
+                                     account_svc.increase_balance(from_account,
+                                                                  old_escrow.scorum_balance + old_escrow.pending_fee);
 
-        remove(old_escrow);
-    }
+                                     remove(old_escrow);
+                                 });
 }
 
 void database::process_decline_voting_rights()
@@ -1389,6 +1528,11 @@ void database::set_flush_interval(uint32_t flush_blocks)
     _next_flush_block = 0;
 }
 
+void database::set_signature_recovery_threads(uint32_t threads)
+{
+    _signature_cache.set_recovery_threads(threads);
+}
+
 //////////////////// private methods ////////////////////
 
 void database::apply_block(const signed_block& next_block, uint32_t skip)
@@ -1464,6 +1608,9 @@ void database::apply_block(const signed_block& next_block, uint32_t skip)
 
         show_free_memory(false);
 
+        // authority changes of the block can only be reverted by pop_block now
+        _account_authority_cache.on_block_applied();
+
         debug_log(ctx, "apply_block result");
     }
     FC_CAPTURE_AND_RETHROW(((std::string)ctx))
@@ -1489,6 +1636,36 @@ void database::show_free_memory(bool force)
     }
 }
 
+block_timing::stats_map database::get_block_timing_stats() const
+{
+    return _block_timing.get_stats();
+}
+
+operation_timing::stats_map database::get_operation_timing_stats() const
+{
+    return _operation_timing.get_stats();
+}
+
+account_authority_cache& database::get_account_authority_cache()
+{
+    return _account_authority_cache;
+}
+
+signature_cache& database::get_signature_cache()
+{
+    return _signature_cache;
+}
+
+expiration_scheduler& database::get_expiration_scheduler()
+{
+    return _expiration_scheduler;
+}
+
+void database::on_undo()
+{
+    _account_authority_cache.on_undo();
+}
+
 void database::_apply_block(const signed_block& next_block)
 {
     block_info ctx(next_block);
@@ -1497,6 +1674,8 @@ void database::_apply_block(const signed_block& next_block)
 
     try
     {
+        block_timing_scope apply_block_timing(&_block_timing, "phase.apply_block");
+
         notify_pre_applied_block(next_block);
 
         uint32_t next_block_num = next_block.block_num();
@@ -1506,6 +1685,8 @@ void database::_apply_block(const signed_block& next_block)
 
         if (!(skip & skip_merkle_check))
         {
+            block_timing_scope timing(&_block_timing, "phase.merkle");
+
             auto merkle_root = next_block.calculate_merkle_root();
 
             try
@@ -1530,6 +1711,8 @@ void database::_apply_block(const signed_block& next_block)
             }
         }
 
+        block_timing_scope header_timing(&_block_timing, "phase.header_validation");
+
         const witness_object& signing_witness = validate_block_header(skip, next_block);
 
         _current_block_num = next_block_num;
@@ -1554,6 +1737,18 @@ void database::_apply_block(const signed_block& next_block)
                   "Block produced by witness that is not running current hardfork",
                   ("witness", witness)("next_block.witness", next_block.witness)("hardfork_state", hardfork_state));
 
+        header_timing.stop();
+
+        if (_signature_cache.get_recovery_threads() > 1
+            && !(skip & (skip_transaction_signatures | skip_authority_check)))
+        {
+            // stateless part of verification, transactions are still applied one by one below
+            block_timing_scope timing(&_block_timing, "phase.signature_recovery");
+            _signature_cache.recover_in_parallel(next_block.transactions, get_chain_id());
+        }
+
+        block_timing_scope transactions_timing(&_block_timing, "phase.transactions");
+
         debug_log(ctx, "apply_transactions");
         for (const auto& trx : next_block.transactions)
         {
@@ -1571,27 +1766,49 @@ void database::_apply_block(const signed_block& next_block)
             ++_current_trx_in_block;
         }
 
-        debug_log(ctx, "update_global_dynamic_data");
-        update_global_dynamic_data(next_block);
-        debug_log(ctx, "update_signing_witness");
-        update_signing_witness(signing_witness, next_block);
+        transactions_timing.stop();
+
+        {
+            block_timing_scope timing(&_block_timing, "phase.global_properties");
 
-        debug_log(ctx, "update_last_irreversible_block");
-        update_last_irreversible_block();
+            debug_log(ctx, "update_global_dynamic_data");
+            update_global_dynamic_data(next_block);
+            debug_log(ctx, "update_signing_witness");
+            update_signing_witness(signing_witness, next_block);
+        }
 
-        debug_log(ctx, "create_block_summary");
-        create_block_summary(next_block);
-        debug_log(ctx, "clear_expired_transactions");
-        clear_expired_transactions();
-        debug_log(ctx, "clear_expired_delegations");
-        clear_expired_delegations();
+        {
+            block_timing_scope timing(&_block_timing, "phase.irreversibility");
 
-        // in dbs_database_witness_schedule.cpp
-        update_witness_schedule();
+            debug_log(ctx, "update_last_irreversible_block");
+            update_last_irreversible_block();
+        }
+
+        {
+            block_timing_scope timing(&_block_timing, "phase.clear_expired");
+
+            debug_log(ctx, "create_block_summary");
+            create_block_summary(next_block);
+            debug_log(ctx, "clear_expired_transactions");
+            clear_expired_transactions();
+            debug_log(ctx, "clear_expired_delegations");
+            clear_expired_delegations();
+        }
+
+        {
+            block_timing_scope timing(&_block_timing, "phase.witness_schedule");
+
+            // in dbs_database_witness_schedule.cpp
+            update_witness_schedule();
+        }
+
+        block_timing_scope tasks_timing(&_block_timing, "phase.tasks");
 
         database_ns::block_task_context task_ctx(static_cast<data_service_factory&>(*this),
                                                  static_cast<database_virtual_operations_emmiter_i&>(*this),
                                                  _current_block_num, ctx);
+        task_ctx.set_timing(&_block_timing);
+        task_ctx.set_expiration_scheduler(&_expiration_scheduler);
 
         database_ns::process_funds(task_ctx).apply(task_ctx);
         database_ns::process_fifa_world_cup_2018_bounty_initialize().apply(task_ctx);
@@ -1611,21 +1828,35 @@ void database::_apply_block(const signed_block& next_block)
                                                  get_dba<dynamic_global_property_object>())
             .apply(task_ctx);
 
-        debug_log(ctx, "account_recovery_processing");
-        account_recovery_processing();
-        debug_log(ctx, "expire_escrow_ratification");
-        expire_escrow_ratification();
-        debug_log(ctx, "process_decline_voting_rights");
-        process_decline_voting_rights();
+        tasks_timing.stop();
+
+        {
+            block_timing_scope timing(&_block_timing, "phase.expirations");
+
+            debug_log(ctx, "account_recovery_processing");
+            account_recovery_processing();
+            debug_log(ctx, "expire_escrow_ratification");
+            expire_escrow_ratification();
+            debug_log(ctx, "process_decline_voting_rights");
+            process_decline_voting_rights();
 
-        debug_log(ctx, "clear_expired_proposals");
-        obtain_service<dbs_proposal>().clear_expired_proposals();
+            debug_log(ctx, "clear_expired_proposals");
+            obtain_service<dbs_proposal>().clear_expired_proposals();
+        }
+
+        {
+            block_timing_scope timing(&_block_timing, "phase.hardforks");
+
+            debug_log(ctx, "process_hardforks");
+            process_hardforks();
+        }
 
-        debug_log(ctx, "process_hardforks");
-        process_hardforks();
+        {
+            block_timing_scope timing(&_block_timing, "phase.applied_block_notification");
 
-        // notify observers that the block has been applied
-        notify_applied_block(next_block);
+            // notify observers that the block has been applied
+            notify_applied_block(next_block);
+        }
 
         debug_log(ctx, "_apply_block result");
     }
@@ -1706,19 +1937,16 @@ void database::_apply_transaction(const signed_transaction& trx)
 
         if (!(skip & (skip_transaction_signatures | skip_authority_check)))
         {
-            auto get_active = [&](const std::string& name) {
-                return authority(get<account_authority_object, by_account>(name).active);
-            };
-            auto get_owner = [&](const std::string& name) {
-                return authority(get<account_authority_object, by_account>(name).owner);
-            };
-            auto get_posting = [&](const std::string& name) {
-                return authority(get<account_authority_object, by_account>(name).posting);
-            };
+            auto get_active
+                = [&](const std::string& name) { return _account_authority_cache.get(*this, name).active; };
+            auto get_owner = [&](const std::string& name) { return _account_authority_cache.get(*this, name).owner; };
+            auto get_posting
+                = [&](const std::string& name) { return _account_authority_cache.get(*this, name).posting; };
 
             try
             {
-                trx.verify_authority(get_chain_id(), get_active, get_owner, get_posting, SCORUM_MAX_SIG_CHECK_DEPTH);
+                protocol::verify_authority(trx.operations, _signature_cache.get_signature_keys(trx, get_chain_id()),
+                                           get_active, get_owner, get_posting, SCORUM_MAX_SIG_CHECK_DEPTH);
             }
             catch (protocol::tx_missing_active_auth& e)
             {
@@ -1787,7 +2015,11 @@ void database::apply_operation(const operation& op)
     auto note = create_notification(op);
 
     notify_pre_apply_operation(note);
-    _my->_evaluator_registry.get_evaluator(op).apply(op);
+    {
+        operation_timing::scope timing(_operation_timing, op.which());
+        _my->_evaluator_registry.get_evaluator(op).apply(op);
+        timing.succeeded();
+    }
     notify_post_apply_operation(note);
 }
 
@@ -1997,7 +2229,7 @@ void database::update_last_irreversible_block()
                 {
                     std::shared_ptr<fork_item> block = _fork_db.fetch_block_on_main_branch_by_number(log_head_num + 1);
                     FC_ASSERT(block, "Current fork in the fork database does not contain the last_irreversible_block");
-                    _block_log.append(block->data);
+                    _block_log.append(block->data, block->packed_data(), block->id);
                     log_head_num++;
                 }
 
@@ -2014,12 +2246,16 @@ void database::clear_expired_transactions()
 {
     // Look for expired transactions in the deduplication list, and remove them.
     // Transactions must have expired by at least two forking windows in order to be removed.
-    auto& transaction_idx = get_index<transaction_index>();
-    const auto& dedupe_index = transaction_idx.indices().get<by_expiration>();
-    while ((!dedupe_index.empty()) && (head_block_time() > dedupe_index.begin()->expiration))
-    {
-        remove(*dedupe_index.begin());
-    }
+    const auto now = head_block_time();
+    const auto& dedupe_index = get_index<transaction_index>().indices().get<by_expiration>();
+
+    _expiration_scheduler.expire(expiration_type::transaction,
+                                 [&]() -> const transaction_object* {
+                                     return !dedupe_index.empty() && now > dedupe_index.begin()->expiration
+                                         ? &*dedupe_index.begin()
+                                         : nullptr;
+                                 },
+                                 [&](const transaction_object& trx) { remove(trx); });
 }
 
 void database::clear_expired_delegations()
@@ -2027,17 +2263,23 @@ void database::clear_expired_delegations()
     auto now = head_block_time();
     const auto& delegations_by_exp = get_index<scorumpower_delegation_expiration_index, by_expiration>();
     const auto& account_svc = account_service();
-    auto itr = delegations_by_exp.begin();
-    while (itr != delegations_by_exp.end() && itr->expiration < now)
-    {
-        modify(account_svc.get_account(itr->delegator),
-               [&](account_object& a) { a.delegated_scorumpower -= itr->scorumpower; });
-
-        push_virtual_operation(return_scorumpower_delegation_operation(itr->delegator, itr->scorumpower));
 
-        remove(*itr);
-        itr = delegations_by_exp.begin();
-    }
+    _expiration_scheduler.expire(expiration_type::scorumpower_delegation,
+                                 [&]() -> const scorumpower_delegation_expiration_object* {
+                                     auto itr = delegations_by_exp.begin();
+                                     return itr != delegations_by_exp.end() && itr->expiration < now ? &*itr : nullptr;
+                                 },
+                                 [&](const scorumpower_delegation_expiration_object& delegation) {
+                                     modify(account_svc.get_account(delegation.delegator),
+                                            [&](account_object& a) {
+                                                a.delegated_scorumpower -= delegation.scorumpower;
+                                            });
+
+                                     push_virtual_operation(return_scorumpower_delegation_operation(
+                                         delegation.delegator, delegation.scorumpower));
+
+                                     remove(delegation);
+                                 });
 }
 
 const genesis_persistent_state_type& database::genesis_persistent_state() const
@@ -12,6 +12,7 @@ void fork_database::reset()
 {
     _head.reset();
     _index.clear();
+    _main_branch.clear();
 }
 
 void fork_database::pop_block()
@@ -19,14 +20,15 @@ void fork_database::pop_block()
     FC_ASSERT(_head, "cannot pop an empty fork database");
     auto prev = _head->prev.lock();
     FC_ASSERT(prev, "popping head block would leave fork DB empty");
-    _head = prev;
+    _set_head(prev);
 }
 
 void fork_database::start_block(signed_block b)
 {
     auto item = std::make_shared<fork_item>(std::move(b));
     _index.insert(item);
-    _head = item;
+    _main_branch.clear();
+    _set_head(item);
 }
 
 /**
@@ -43,7 +45,7 @@ std::shared_ptr<fork_item> fork_database::push_block(const signed_block& b)
     catch (const unlinkable_block_exception&)
     {
         wlog("Pushing block to fork database that failed to link: ${id}, ${num}", ("id", b.id())("num", b.block_num()));
-        wlog("Head: ${num}, ${id}", ("num", _head->data.block_num())("id", _head->data.id()));
+        wlog("Head: ${num}, ${id}", ("num", _head->num)("id", _head->id));
         throw;
         _unlinked_index.insert(item);
     }
@@ -70,7 +72,40 @@ void fork_database::_push_block(const item_ptr& item)
 
     _index.insert(item);
     if (!_head || item->num > _head->num)
-        _head = item;
+        _set_head(item);
+}
+
+/**
+ *  Makes h the head and rebuilds the tail of the main branch: walks back from h
+ *  until it meets a block which is already on the main branch. For a block extending
+ *  the head this is O(1), for a fork switch it is O(fork depth).
+ */
+void fork_database::_set_head(const item_ptr& h)
+{
+    _head = h;
+
+    branch_type new_tail;
+    item_ptr item = h;
+    while (item && _fetch_from_main_branch(item->num) != item)
+    {
+        new_tail.push_back(item);
+        item = item->prev.lock();
+    }
+
+    if (item)
+        _main_branch.resize(item->num - _main_branch.front()->num + 1);
+    else
+        _main_branch.clear();
+
+    std::copy(new_tail.rbegin(), new_tail.rend(), std::back_inserter(_main_branch));
+}
+
+item_ptr fork_database::_fetch_from_main_branch(uint32_t block_num) const
+{
+    if (_main_branch.empty() || block_num < _main_branch.front()->num || block_num > _main_branch.back()->num)
+        return item_ptr();
+
+    return _main_branch[block_num - _main_branch.front()->num];
 }
 
 /**
@@ -112,6 +147,11 @@ void fork_database::set_max_size(uint32_t s)
             itr = by_num_idx.begin();
         }
     }
+    { /// main branch
+        while (!_main_branch.empty()
+               && _main_branch.front()->num < std::max(int64_t(0), int64_t(_head->num) - _max_size))
+            _main_branch.pop_front();
+    }
     { /// unlinked_index
         auto& by_num_idx = _unlinked_index.get<block_num>();
         auto itr = by_num_idx.begin();
@@ -185,13 +225,13 @@ fork_database::fetch_branch_from(block_id_type first, block_id_type second) cons
         FC_ASSERT(second_branch_itr != _index.get<block_id>().end());
         auto second_branch = *second_branch_itr;
 
-        while (first_branch->data.block_num() > second_branch->data.block_num())
+        while (first_branch->num > second_branch->num)
         {
             result.first.push_back(first_branch);
             first_branch = first_branch->prev.lock();
             FC_ASSERT(first_branch);
         }
-        while (second_branch->data.block_num() > first_branch->data.block_num())
+        while (second_branch->num > first_branch->num)
         {
             result.second.push_back(second_branch);
             second_branch = second_branch->prev.lock();
@@ -218,28 +258,24 @@ fork_database::fetch_branch_from(block_id_type first, block_id_type second) cons
 
 std::shared_ptr<fork_item> fork_database::walk_main_branch_to_num(uint32_t block_num) const
 {
-    std::shared_ptr<fork_item> next = head();
-    if (block_num > next->num)
-        return std::shared_ptr<fork_item>();
-
-    while (next.get() != nullptr && next->num > block_num)
-        next = next->prev.lock();
-    return next;
+    return _fetch_from_main_branch(block_num);
 }
 
 std::shared_ptr<fork_item> fork_database::fetch_block_on_main_branch_by_number(uint32_t block_num) const
 {
+    auto item = _fetch_from_main_branch(block_num);
+    if (item)
+        return item;
+
     std::vector<item_ptr> blocks = fetch_block_by_number(block_num);
     if (blocks.size() == 1)
         return blocks[0];
-    if (blocks.size() == 0)
-        return std::shared_ptr<fork_item>();
-    return walk_main_branch_to_num(block_num);
+    return std::shared_ptr<fork_item>();
 }
 
 void fork_database::set_head(std::shared_ptr<fork_item> h)
 {
-    _head = h;
+    _set_head(h);
 }
 
 void fork_database::remove(block_id_type id)
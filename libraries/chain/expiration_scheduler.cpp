@@ -0,0 +1,63 @@
+#include <scorum/chain/expiration_scheduler.hpp>
+
+#include <fc/exception/exception.hpp>
+
+#include <algorithm>
+
+namespace scorum {
+namespace chain {
+
+void expiration_scheduler::add(expiration_type type, size_t count)
+{
+    auto& s = _stats[static_cast<size_t>(type)];
+
+    s.last = (uint32_t)count;
+    if (count == 0)
+        return;
+
+    s.expired += count;
+    s.blocks += 1;
+    s.max = std::max(s.max, s.last);
+}
+
+expiration_scheduler::stats_map expiration_scheduler::get_stats() const
+{
+    stats_map result;
+    for (size_t i = 0; i < _stats.size(); ++i)
+        result[get_type_name(static_cast<expiration_type>(i))] = _stats[i];
+    return result;
+}
+
+void expiration_scheduler::clear()
+{
+    _stats.fill(stats());
+}
+
+std::string expiration_scheduler::get_type_name(expiration_type type)
+{
+    switch (type)
+    {
+    case expiration_type::transaction:
+        return "transaction";
+    case expiration_type::scorumpower_delegation:
+        return "scorumpower_delegation";
+    case expiration_type::proposal:
+        return "proposal";
+    case expiration_type::escrow_ratification:
+        return "escrow_ratification";
+    case expiration_type::account_recovery_request:
+        return "account_recovery_request";
+    case expiration_type::owner_authority_history:
+        return "owner_authority_history";
+    case expiration_type::change_recovery_account_request:
+        return "change_recovery_account_request";
+    case expiration_type::atomicswap_contract:
+        return "atomicswap_contract";
+    case expiration_type::account_registration_bonus:
+        return "account_registration_bonus";
+    default:
+        FC_THROW("unknown expiration type ${t}", ("t", static_cast<int>(type)));
+    }
+}
+}
+}
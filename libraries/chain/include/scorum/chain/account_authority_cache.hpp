@@ -0,0 +1,66 @@
+#pragma once
+
+#include <scorum/chain/dba/dba.hpp>
+
+#include <scorum/protocol/authority.hpp>
+
+#include <map>
+#include <set>
+#include <string>
+
+namespace scorum {
+namespace chain {
+
+using scorum::protocol::authority;
+using scorum::protocol::account_name_type;
+
+/**
+ * Authorities of accounts converted from account_authority_object for transaction verification.
+ *
+ * Entries of accounts whose authority is created or updated are dropped. Such accounts are also remembered
+ * until the change becomes a part of an applied block, so undoing a session drops them again. Changes of
+ * applied blocks are only reverted by pop_block, which clears the cache.
+ */
+class account_authority_cache
+{
+public:
+    struct entry
+    {
+        authority owner;
+        authority active;
+        authority posting;
+    };
+
+    explicit account_authority_cache(size_t max_size = 100000);
+
+    /// returns authorities of the account, looks up the object in the database on a miss
+    const entry& get(const dba::db_index& db, const std::string& name);
+
+    void on_changed(const account_name_type& name);
+    void on_undo();
+    void on_block_applied();
+
+    void clear();
+
+    void set_enabled(bool enabled);
+    bool is_enabled() const;
+
+    size_t size() const;
+    uint64_t hits() const;
+    uint64_t misses() const;
+
+private:
+    entry load(const dba::db_index& db, const std::string& name) const;
+
+    std::map<std::string, entry> _entries;
+    std::set<std::string> _changed;
+
+    entry _uncached;
+
+    size_t _max_size;
+    bool _enabled = true;
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+};
+}
+}
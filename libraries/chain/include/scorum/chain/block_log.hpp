@@ -49,6 +49,10 @@ public:
     static fc::path block_log_index_path(const fc::path& block_log_file);
 
     uint64_t append(const signed_block& b);
+    /**
+     * Appends an already serialized block, packed_block must be fc::raw::pack(b) and id must be b.id()
+     */
+    uint64_t append(const signed_block& b, const std::vector<char>& packed_block, const block_id_type& id);
     void flush();
     std::pair<signed_block, uint64_t> read_block(uint64_t file_pos) const;
     optional<signed_block> read_block_by_num(uint32_t block_num) const;
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <fc/reflect/reflect.hpp>
+
+#include <boost/circular_buffer.hpp>
+
+#include <chrono>
+#include <map>
+#include <string>
+
+namespace scorum {
+namespace chain {
+
+/**
+ * Rolling duration statistics of the stages of block application: chain phases of
+ * database::_apply_block and every task<> applied for the block.
+ */
+class block_timing
+{
+public:
+    struct stats
+    {
+        /// samples recorded since node start
+        uint64_t count = 0;
+
+        /// over the last window of samples, in microseconds
+        uint32_t last = 0;
+        uint32_t mean = 0;
+        uint32_t p50 = 0;
+        uint32_t p90 = 0;
+        uint32_t p99 = 0;
+        uint32_t max = 0;
+    };
+
+    using stats_map = std::map<std::string, stats>;
+
+    explicit block_timing(size_t window = 1200);
+
+    void add(const std::string& name, uint32_t microseconds);
+
+    stats_map get_stats() const;
+
+    void clear();
+
+private:
+    struct samples
+    {
+        explicit samples(size_t window)
+            : last(window)
+        {
+        }
+
+        uint64_t count = 0;
+        boost::circular_buffer<uint32_t> last;
+    };
+
+    size_t _window;
+    std::map<std::string, samples> _samples;
+};
+
+/// Adds the time spent in its scope to block_timing under given name. Null timing disables it.
+class block_timing_scope
+{
+public:
+    block_timing_scope(block_timing* timing, const char* name)
+        : _timing(timing)
+        , _name(name)
+    {
+        if (_timing)
+            _start = std::chrono::steady_clock::now();
+    }
+
+    ~block_timing_scope()
+    {
+        stop();
+    }
+
+    /// records the duration before the end of scope, the destructor does nothing afterwards
+    void stop()
+    {
+        if (_timing)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - _start;
+            _timing->add(_name, (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            _timing = nullptr;
+        }
+    }
+
+private:
+    block_timing* _timing;
+    const char* _name;
+    std::chrono::steady_clock::time_point _start;
+};
+}
+}
+
+FC_REFLECT(scorum::chain::block_timing::stats, (count)(last)(mean)(p50)(p90)(p99)(max))
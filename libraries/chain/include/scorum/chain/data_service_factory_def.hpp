@@ -85,7 +85,8 @@ struct db_accessor_factory;
     BOOST_PP_SEQ_FOR_EACH(DECLARE_FACTORY_METHOD_IMPL, _, SERVICES)                                                    \
     account_service_i& data_service_factory::account_service() const                                                   \
     {                                                                                                                  \
-        return factory.obtain_service_explicit<dbs_account>(dynamic_global_property_service(), witness_service());     \
+        return factory.obtain_service_explicit<dbs_account>(dynamic_global_property_service(), witness_service(),      \
+                                                            factory.authority_cache());                                \
     }                                                                                                                  \
     witness_service_i& data_service_factory::witness_service() const                                                   \
     {                                                                                                                  \
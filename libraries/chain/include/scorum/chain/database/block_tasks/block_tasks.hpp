@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scorum/chain/tasks_base.hpp>
+#include <scorum/chain/expiration_scheduler.hpp>
 
 #include <scorum/chain/database/database_virtual_operations.hpp>
 #include <scorum/chain/database/debug_log.hpp>
@@ -37,13 +38,42 @@ public:
         return _block_num;
     }
 
+    block_timing* timing() const
+    {
+        return _timing;
+    }
+
+    void set_timing(block_timing* timing)
+    {
+        _timing = timing;
+    }
+
+    /// tasks expiring objects count them here
+    void count_expired(expiration_type type, size_t count) const
+    {
+        if (_expirations)
+            _expirations->add(type, count);
+    }
+
+    void set_expiration_scheduler(expiration_scheduler* expirations)
+    {
+        _expirations = expirations;
+    }
+
 private:
     data_service_factory_i& _services;
     database_virtual_operations_emmiter_i& _vops;
     uint32_t _block_num;
     block_info& _block_info;
+    block_timing* _timing = nullptr;
+    expiration_scheduler* _expirations = nullptr;
 };
 
+inline block_timing* get_block_timing(block_task_context& ctx)
+{
+    return ctx.timing();
+}
+
 class block_task_type : public task<block_task_context>
 {
 protected:
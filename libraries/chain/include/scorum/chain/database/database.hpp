@@ -8,6 +8,11 @@
 #include <scorum/chain/node_property_object.hpp>
 #include <scorum/chain/database/fork_database.hpp>
 #include <scorum/chain/block_log.hpp>
+#include <scorum/chain/block_timing.hpp>
+#include <scorum/chain/operation_timing.hpp>
+#include <scorum/chain/account_authority_cache.hpp>
+#include <scorum/chain/signature_cache.hpp>
+#include <scorum/chain/expiration_scheduler.hpp>
 #include <scorum/chain/operation_notification.hpp>
 
 #include <scorum/protocol/protocol.hpp>
@@ -147,6 +152,8 @@ public:
     optional<signed_block> fetch_block_by_id(const block_id_type& id) const;
     optional<signed_block> fetch_block_by_number(uint32_t num) const;
     optional<signed_block> read_block_by_number(uint32_t num) const;
+    /// serialized block, reversible blocks are served from the fork database without re-packing
+    optional<std::vector<char>> fetch_packed_block_by_id(const block_id_type& id) const;
 
     const signed_transaction get_recent_transaction(const transaction_id_type& trx_id) const;
     std::vector<block_id_type> get_block_ids_on_fork(block_id_type head_of_fork) const;
@@ -180,6 +187,19 @@ public:
                                 const fc::ecc::private_key& block_signing_private_key,
                                 uint32_t skip);
 
+    /**
+     * Selects pending transactions for the block of the given slot ahead of time. generate_block reuses them
+     * instead of re-applying the pending queue while the head block stays the same. Transactions which arrive
+     * after the call wait for the next block unless the candidate is prepared again.
+     */
+    void prepare_block_candidate(const fc::time_point_sec when, uint32_t skip);
+
+    /// true if generate_block for the slot will use the prepared candidate
+    bool has_block_candidate(const fc::time_point_sec when) const;
+
+    /// true if the candidate for the slot is built over the head block and all pending transactions
+    bool is_block_candidate_actual(const fc::time_point_sec when) const;
+
     void pop_block();
     void clear_pending();
 
@@ -199,6 +219,7 @@ public:
 
     void notify_pre_applied_block(const signed_block& block);
     void notify_applied_block(const signed_block& block);
+    void notify_popped_block(const signed_block& block);
     void notify_on_pending_transaction(const signed_transaction& tx);
     void notify_on_pre_apply_transaction(const signed_transaction& tx);
     void notify_on_applied_transaction(const signed_transaction& tx);
@@ -220,6 +241,12 @@ public:
      */
     fc::signal<void(const signed_block&)> applied_block;
 
+    /**
+     *  This signal is emitted after the state of the head block has been undone by pop_block,
+     *  e.g. while switching forks.
+     */
+    fc::signal<void(const signed_block&)> popped_block;
+
     /**
      * This signal is emitted any time a new transaction is added to the pending
      * block state.
@@ -319,8 +346,27 @@ public:
     void validate_invariants() const;
 
     void set_flush_interval(uint32_t flush_blocks);
+
+    /// signatures of block transactions are recovered by this many threads before the transactions are applied,
+    /// the threads are started here and reused for every block
+    void set_signature_recovery_threads(uint32_t threads);
     void show_free_memory(bool force);
 
+    /// rolling durations of _apply_block phases and block tasks, in microseconds
+    block_timing::stats_map get_block_timing_stats() const;
+
+    /// evaluation counters and latency histograms per operation type
+    operation_timing::stats_map get_operation_timing_stats() const;
+
+    /// authorities used by transaction verification, services drop entries of changed accounts
+    account_authority_cache& get_account_authority_cache();
+
+    /// public keys recovered from signatures of pushed and applied transactions
+    signature_cache& get_signature_cache();
+
+    /// expiring objects are walked through it, counts expired objects per type
+    expiration_scheduler& get_expiration_scheduler();
+
     // index
 
     template <typename MultiIndexType> void add_plugin_index()
@@ -345,7 +391,18 @@ private:
                                  const account_name_type& witness_owner,
                                  const fc::ecc::private_key& block_signing_private_key);
 
+    /**
+     * Applies pending transactions which fit the block for the slot, the caller owns the undo session. Transactions
+     * expired for the slot or over the block size go to skipped, failed ones are dropped.
+     */
+    std::vector<signed_transaction>
+    _apply_pending_transactions_for_block(const fc::time_point_sec when,
+                                          const std::vector<signed_transaction>& pending,
+                                          std::vector<signed_transaction>* skipped = nullptr);
+
 protected:
+    virtual void on_undo() override;
+
     void set_producing(bool p)
     {
         _is_producing = p;
@@ -384,6 +441,19 @@ private:
     optional<chainbase::abstract_undo_session_ptr> _pending_tx_session;
 
     std::vector<signed_transaction> _pending_tx;
+    /// changes whenever _pending_tx does
+    uint64_t _pending_tx_generation = 0;
+
+    struct block_candidate
+    {
+        block_id_type previous;
+        fc::time_point_sec timestamp;
+        uint64_t pending_tx_generation = 0;
+        std::vector<signed_transaction> transactions;
+    };
+
+    optional<block_candidate> _block_candidate;
+
     fork_database _fork_db;
     fc::time_point_sec _hardfork_times[SCORUM_NUM_HARDFORKS + 1];
     protocol::hardfork_version _hardfork_versions[SCORUM_NUM_HARDFORKS + 1];
@@ -406,6 +476,12 @@ private:
 
     uint32_t _last_free_gb_printed = 0;
 
+    block_timing _block_timing;
+    operation_timing _operation_timing;
+    account_authority_cache _account_authority_cache;
+    signature_cache _signature_cache;
+    expiration_scheduler _expiration_scheduler;
+
     fc::time_point_sec _const_genesis_time; // should be const
 };
 } // namespace chain
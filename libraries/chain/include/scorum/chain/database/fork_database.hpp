@@ -7,6 +7,8 @@
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 
+#include <deque>
+
 namespace scorum {
 namespace chain {
 using boost::multi_index_container;
@@ -21,6 +23,7 @@ struct fork_item
         : num(d.block_num())
         , id(d.id())
         , data(std::move(d))
+        , _packed_data(fc::raw::pack(data))
     {
     }
 
@@ -29,6 +32,15 @@ struct fork_item
         return data.previous;
     }
 
+    /**
+     * Serialized block, reused for block_log append and p2p re-serving. It is packed in the ctor, so threads may
+     * share it without a lock.
+     */
+    const std::vector<char>& packed_data() const
+    {
+        return _packed_data;
+    }
+
     std::weak_ptr<fork_item> prev;
     uint32_t num; // initialized in ctor
     /**
@@ -38,6 +50,9 @@ struct fork_item
     bool invalid = false;
     block_id_type id;
     signed_block data;
+
+private:
+    const std::vector<char> _packed_data; // after data, initialized in ctor
 };
 typedef std::shared_ptr<fork_item> item_ptr;
 
@@ -108,12 +123,20 @@ private:
     /** @return a pointer to the newly pushed item */
     void _push_block(const item_ptr& b);
     void _push_next(const item_ptr& newly_inserted);
+    void _set_head(const item_ptr& h);
+    item_ptr _fetch_from_main_branch(uint32_t block_num) const;
 
     uint32_t _max_size = 1024;
 
     fork_multi_index_type _unlinked_index;
     fork_multi_index_type _index;
     std::shared_ptr<fork_item> _head;
+
+    /**
+     * Blocks from the oldest cached one up to _head following prev links,
+     * _main_branch[i]->num == _main_branch.front()->num + i
+     */
+    std::deque<item_ptr> _main_branch;
 };
 
 } // namespace chain
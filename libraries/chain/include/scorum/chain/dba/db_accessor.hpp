@@ -121,8 +121,8 @@ template <typename TIdx, typename TKey> auto get_lower_bound(TIdx& idx, const de
 template <typename TIdx, typename TKey> auto get_upper_bound(TIdx& idx, const detail::bound<TKey>& bound);
 
 template <typename TObject, typename IndexBy, typename TKeyLhs, typename TKeyRhs = TKeyLhs>
-utils::bidir_range<const TObject>
-get_range_by(db_index& db_idx, const detail::bound<TKeyLhs>& lower, const detail::bound<TKeyRhs>& upper)
+index_range_type<TObject, IndexBy>
+get_index_range_by(db_index& db_idx, const detail::bound<TKeyLhs>& lower, const detail::bound<TKeyRhs>& upper)
 {
     const auto& idx = db_idx.get_index<typename chainbase::get_index_type<TObject>::type, IndexBy>();
 
@@ -132,13 +132,29 @@ get_range_by(db_index& db_idx, const detail::bound<TKeyLhs>& lower, const detail
     return { from, to };
 }
 
-template <typename TObject, typename IndexBy> utils::bidir_range<const TObject> get_all_by(db_index& db_idx)
+template <typename TObject, typename IndexBy> index_range_type<TObject, IndexBy> get_index_all_by(db_index& db_idx)
 {
     const auto& idx = db_idx.get_index<typename chainbase::get_index_type<TObject>::type, IndexBy>();
 
     return { idx.begin(), idx.end() };
 }
 
+template <typename TObject, typename IndexBy, typename TKeyLhs, typename TKeyRhs = TKeyLhs>
+utils::bidir_range<const TObject>
+get_range_by(db_index& db_idx, const detail::bound<TKeyLhs>& lower, const detail::bound<TKeyRhs>& upper)
+{
+    auto range = get_index_range_by<TObject, IndexBy, TKeyLhs, TKeyRhs>(db_idx, lower, upper);
+
+    return { range.begin(), range.end() };
+}
+
+template <typename TObject, typename IndexBy> utils::bidir_range<const TObject> get_all_by(db_index& db_idx)
+{
+    auto range = get_index_all_by<TObject, IndexBy>(db_idx);
+
+    return { range.begin(), range.end() };
+}
+
 template <typename TIdx, typename TKey> auto get_lower_bound(TIdx& idx, const detail::bound<TKey>& bound)
 {
     switch (bound.kind)
@@ -288,6 +304,48 @@ public:
         return detail::get_all_by<TObject, IndexBy>(_db_idx);
     }
 
+    // get_index_range_by/get_index_all_by return the index's own iterator range. Iterating it avoids the virtual
+    // calls of the type-erased ranges above, so use them on hot paths inside the chain. Keep the erased ranges where
+    // the range crosses an interface (virtual methods, API) or where tests substitute the detail functions.
+    template <typename IndexBy, typename TKey>
+    index_range_type<TObject, IndexBy> get_index_range_by(const TKey& key) const
+    {
+        return detail::get_index_range_by<TObject, IndexBy, TKey>(_db_idx, key <= _x, _x <= key);
+    }
+
+    template <typename IndexBy, typename TKeyLhs, typename TKeyRhs = TKeyLhs>
+    index_range_type<TObject, IndexBy> get_index_range_by(const detail::bound<TKeyLhs>& lower,
+                                                          const detail::bound<TKeyRhs>& upper) const
+    {
+        return detail::get_index_range_by<TObject, IndexBy, TKeyLhs, TKeyRhs>(_db_idx, lower, upper);
+    }
+
+    template <typename IndexBy, typename TKey>
+    index_range_type<TObject, IndexBy> get_index_range_by(unbounded_placeholder lower,
+                                                          const detail::bound<TKey>& upper) const
+    {
+        return detail::get_index_range_by<TObject, IndexBy, TKey, TKey>(_db_idx, lower, upper);
+    }
+
+    template <typename IndexBy, typename TKey>
+    index_range_type<TObject, IndexBy> get_index_range_by(const detail::bound<TKey>& lower,
+                                                          unbounded_placeholder upper) const
+    {
+        return detail::get_index_range_by<TObject, IndexBy, TKey, TKey>(_db_idx, lower, upper);
+    }
+
+    template <typename IndexBy, typename TKey = index_key_type<TObject, IndexBy>>
+    index_range_type<TObject, IndexBy> get_index_range_by(unbounded_placeholder lower,
+                                                          unbounded_placeholder upper) const
+    {
+        return detail::get_index_range_by<TObject, IndexBy, TKey, TKey>(_db_idx, lower, upper);
+    }
+
+    template <typename IndexBy> index_range_type<TObject, IndexBy> get_index_all_by() const
+    {
+        return detail::get_index_all_by<TObject, IndexBy>(_db_idx);
+    }
+
 private:
     db_index& _db_idx;
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include <boost/optional/optional.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <chainbase/generic_index.hpp>
 
 namespace scorum {
@@ -23,6 +24,14 @@ template <typename TObject, typename TIndexBy>
 using index_key_type =
     typename boost::multi_index::index<typename chainbase::get_index_type<TObject>::type, TIndexBy>::type::key_type;
 
+template <typename TObject, typename TIndexBy>
+using index_iterator_type = typename boost::multi_index::
+    index<typename chainbase::get_index_type<TObject>::type, TIndexBy>::type::const_iterator;
+
+/// range over the index's own iterators, unlike utils::bidir_range it isn't type-erased
+template <typename TObject, typename TIndexBy>
+using index_range_type = boost::iterator_range<index_iterator_type<TObject, TIndexBy>>;
+
 namespace detail {
 enum class bound_kind
 {
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <fc/reflect/reflect.hpp>
+
+#include <array>
+#include <map>
+#include <string>
+
+namespace scorum {
+namespace chain {
+
+/// objects expiring by time, counted separately by expiration_scheduler
+enum class expiration_type
+{
+    transaction,
+    scorumpower_delegation,
+    proposal,
+    escrow_ratification,
+    account_recovery_request,
+    owner_authority_history,
+    change_recovery_account_request,
+    atomicswap_contract,
+    account_registration_bonus,
+
+    types_count
+};
+
+/**
+ * Walks deadline ordered indices of expiring objects and counts expired objects per type.
+ *
+ * Every expiring type keeps its objects in an index ordered by deadline, so checking a type is a look at the
+ * first object of the index and the cost of a block is proportional to the number of expired objects.
+ */
+class expiration_scheduler
+{
+public:
+    struct stats
+    {
+        /// objects expired since node start
+        uint64_t expired = 0;
+
+        /// blocks in which at least one object expired
+        uint64_t blocks = 0;
+
+        /// in the last processed block and the maximum per block
+        uint32_t last = 0;
+        uint32_t max = 0;
+    };
+
+    /// by type name
+    using stats_map = std::map<std::string, stats>;
+
+    /**
+     * Expires objects until first_due returns nullptr. first_due returns the first object of the index which is
+     * due, expire_one must remove it from the index (or make it not due), otherwise the walk would never end.
+     */
+    template <typename FirstDue, typename ExpireOne>
+    size_t expire(expiration_type type, FirstDue&& first_due, ExpireOne&& expire_one)
+    {
+        size_t count = 0;
+        while (const auto* obj = first_due())
+        {
+            expire_one(*obj);
+            ++count;
+        }
+
+        add(type, count);
+
+        return count;
+    }
+
+    /// records objects expired by the caller itself
+    void add(expiration_type type, size_t count);
+
+    stats_map get_stats() const;
+
+    void clear();
+
+    static std::string get_type_name(expiration_type type);
+
+private:
+    std::array<stats, static_cast<size_t>(expiration_type::types_count)> _stats;
+};
+}
+}
+
+FC_REFLECT(scorum::chain::expiration_scheduler::stats, (expired)(blocks)(last)(max))
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <fc/reflect/reflect.hpp>
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace scorum {
+namespace chain {
+
+/**
+ * Counters and latency histograms of evaluators per operation type.
+ *
+ * Samples are stored by operation tag in preallocated arrays, recording is a couple of increments.
+ * Histogram bucket N counts evaluations which took less than 2^N microseconds (the last bucket takes the rest).
+ */
+class operation_timing
+{
+public:
+    static constexpr size_t buckets_count = 24;
+
+    struct stats
+    {
+        uint64_t count = 0;
+        uint64_t failed = 0;
+
+        /// in microseconds, percentiles are upper bounds of histogram buckets
+        uint64_t total = 0;
+        uint32_t mean = 0;
+        uint32_t p50 = 0;
+        uint32_t p90 = 0;
+        uint32_t p99 = 0;
+        uint32_t max = 0;
+
+        std::vector<uint64_t> histogram;
+    };
+
+    using stats_map = std::map<std::string, stats>;
+
+    /// Measures the scope and records it as failed unless succeeded() is called
+    class scope
+    {
+    public:
+        scope(operation_timing& timing, int which)
+            : _timing(timing)
+            , _which(which)
+            , _start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~scope()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - _start;
+            _timing.add(_which, (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(),
+                        !_succeeded);
+        }
+
+        void succeeded()
+        {
+            _succeeded = true;
+        }
+
+    private:
+        operation_timing& _timing;
+        int _which;
+        bool _succeeded = false;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    operation_timing();
+
+    void add(int which, uint32_t microseconds, bool failed = false);
+
+    /// operations which were never evaluated are omitted
+    stats_map get_stats() const;
+
+    void clear();
+
+private:
+    struct samples
+    {
+        uint64_t count = 0;
+        uint64_t failed = 0;
+        uint64_t total = 0;
+        uint32_t max = 0;
+        std::array<uint64_t, buckets_count> histogram = {};
+    };
+
+    std::vector<samples> _samples;
+};
+}
+}
+
+FC_REFLECT(scorum::chain::operation_timing::stats, (count)(failed)(total)(mean)(p50)(p90)(p99)(max)(histogram))
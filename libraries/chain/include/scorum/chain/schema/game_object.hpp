@@ -21,6 +21,7 @@ struct by_uuid;
 struct by_start_time;
 struct by_bets_resolve_time;
 struct by_auto_resolve_time;
+struct by_status_start_time;
 
 class game_uuid_history_object : public object<game_uuid_history_object_type, game_uuid_history_object>
 {
@@ -70,6 +71,7 @@ using game_uuid_history_index
                                                                    uuid_type,
                                                                    &game_uuid_history_object::uuid>>>>;
 
+/// by_status_start_time changed the layout, shared memory files written before it are refused until a replay
 using game_index
     = shared_multi_index_container<game_object,
                                    indexed_by<ordered_unique<tag<by_id>,
@@ -89,7 +91,18 @@ using game_index
                                               ordered_non_unique<tag<by_start_time>,
                                                                  member<game_object,
                                                                         fc::time_point_sec,
-                                                                        &game_object::start_time>>>>;
+                                                                        &game_object::start_time>>,
+                                              ordered_unique<tag<by_status_start_time>,
+                                                             composite_key<game_object,
+                                                                           member<game_object,
+                                                                                  game_status,
+                                                                                  &game_object::status>,
+                                                                           member<game_object,
+                                                                                  fc::time_point_sec,
+                                                                                  &game_object::start_time>,
+                                                                           member<game_object,
+                                                                                  game_object::id_type,
+                                                                                  &game_object::id>>>>>;
 }
 }
 
@@ -7,6 +7,8 @@
 namespace scorum {
 namespace chain {
 
+class account_authority_cache;
+
 struct accounts_total
 {
     /// sum of all SCR balances
@@ -166,7 +168,9 @@ struct account_service_i : public base_service_i<account_object>
 
     using account_refs_type = std::vector<cref_type>;
 
-    virtual account_refs_type get_active_sp_holders() const = 0;
+    using account_view_type = scorum::utils::forward_range<const account_object>;
+
+    virtual account_view_type get_active_sp_holders() const = 0;
 
     using account_call_type = typename base_service_i::call_type;
 
@@ -186,6 +190,12 @@ class dbs_account : public dbs_service_base<account_service_i>
 public:
     explicit dbs_account(dba::db_index&, dynamic_global_property_service_i&, witness_service_i&);
 
+    /// entries of accounts whose authority is created or updated are dropped from the cache
+    dbs_account(dba::db_index&,
+                dynamic_global_property_service_i&,
+                witness_service_i&,
+                account_authority_cache& authority_cache);
+
     using base_service_i<account_object>::get;
     using base_service_i<account_object>::is_exists;
 
@@ -319,7 +329,7 @@ public:
     virtual void
     adjust_proxied_witness_votes(const account_object& account, const share_type& delta, int depth = 0) override;
 
-    virtual account_refs_type get_active_sp_holders() const override;
+    virtual account_view_type get_active_sp_holders() const override;
 
     virtual void foreach_account(account_call_type&&) const override;
 
@@ -330,6 +340,9 @@ public:
 private:
     dynamic_global_property_service_i& _dgp_svc;
     witness_service_i& _witness_svc;
+    void on_authority_changed(const account_name_type& name);
+
+    account_authority_cache* _authority_cache = nullptr;
 };
 
 } // namespace chain
@@ -13,6 +13,7 @@ namespace chain {
 
 class database;
 class dbs_base;
+class account_authority_cache;
 
 class dbservice_dbs_factory
 {
@@ -46,6 +47,9 @@ public:
         return static_cast<ConcreteService&>(*ret);
     }
 
+    /// for services which keep the authority cache in sync
+    account_authority_cache& authority_cache() const;
+
 private:
     mutable boost::container::flat_map<boost::typeindex::type_index, BaseServicePtr> _dbs;
     database& _db_core;
@@ -67,6 +67,9 @@ public:
     void for_all_proposals_remove_from_voting_list(const account_name_type& member) override;
 
     proposal_refs_type get_proposals() override;
+
+private:
+    expiration_scheduler& _expiration_scheduler;
 };
 
 } // namespace scorum
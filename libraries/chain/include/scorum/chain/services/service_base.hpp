@@ -8,6 +8,8 @@
 #include <limits>
 
 #include <boost/range/any_range.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/adaptor/filtered.hpp>
 
 namespace scorum {
 namespace utils {
@@ -190,6 +192,38 @@ public:
         }
         FC_CAPTURE_AND_RETHROW()
     }
+
+    /**
+     * Lazy counterparts of get_range_by/get_filtered_range_by. They walk the index in place without
+     * materialising the result, so the range is valid only until the next modification that relinks
+     * an object of this index (use the vector versions when the loop body changes the index key).
+     */
+    template <class... IndexBy, class LowerBounder, class UpperBounder>
+    auto get_range_view_by(LowerBounder lower, UpperBounder upper) const
+    {
+        try
+        {
+            const auto& idx = db_impl()
+                                  .template get_index<typename chainbase::get_index_type<object_type>::type>()
+                                  .indices()
+                                  .template get<IndexBy...>();
+
+            auto range = idx.range(lower, upper);
+
+            return boost::make_iterator_range(range.first, range.second);
+        }
+        FC_CAPTURE_AND_RETHROW()
+    }
+
+    template <class... IndexBy, class LowerBounder, class UpperBounder, class UnaryPredicate>
+    auto get_filtered_range_view_by(LowerBounder lower, UpperBounder upper, UnaryPredicate filter) const
+    {
+        try
+        {
+            return get_range_view_by<IndexBy...>(lower, upper) | boost::adaptors::filtered(filter);
+        }
+        FC_CAPTURE_AND_RETHROW()
+    }
 };
 
 #define ALL_IDS std::numeric_limits<int64_t>::max()
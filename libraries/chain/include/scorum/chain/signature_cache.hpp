@@ -0,0 +1,101 @@
+#pragma once
+
+#include <scorum/chain/worker_pool.hpp>
+
+#include <scorum/protocol/transaction.hpp>
+
+#include <fc/reflect/reflect.hpp>
+
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace scorum {
+namespace chain {
+
+using scorum::protocol::chain_id_type;
+using scorum::protocol::digest_type;
+using scorum::protocol::public_key_type;
+using scorum::protocol::signed_transaction;
+
+/**
+ * Public keys recovered from transaction signatures.
+ *
+ * A transaction is verified when it is pushed to the pending list and again when it is applied as a part of a
+ * block. Entries are keyed by the signature digest of the transaction together with the signature, so a
+ * transaction with changed content or signatures is recovered anew. The oldest entries are evicted when the cache
+ * is full. The cache may be used from several threads, keys are recovered outside of its lock.
+ */
+class signature_cache
+{
+public:
+    struct stats
+    {
+        uint64_t size = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+
+        /// signatures recovered ahead of block or transaction application by recover_in_parallel and prefetch
+        uint64_t prefetched = 0;
+
+        /// percents of recovered signatures found in the cache
+        double hit_rate = 0;
+    };
+
+    explicit signature_cache(size_t max_size = 50000);
+
+    /// the same as signed_transaction::get_signature_keys, recovers only signatures missing in the cache
+    fc::flat_set<public_key_type> get_signature_keys(const signed_transaction& trx, const chain_id_type& chain_id);
+
+    /**
+     * Recovers signatures of block transactions which are missing in the cache by the recovery threads, so
+     * transactions applied afterwards in order find their keys in the cache. Invalid signatures are skipped here
+     * and fail later on the usual path. Returns the number of recovered signatures, 0 without recovery threads.
+     */
+    size_t recover_in_parallel(const std::vector<signed_transaction>& trxs, const chain_id_type& chain_id);
+
+    /// starts the threads used by recover_in_parallel, including the calling one; 0 and 1 stop them
+    void set_recovery_threads(uint32_t threads);
+    uint32_t get_recovery_threads() const;
+
+    /**
+     * Recovers signatures of one transaction which are missing in the cache, so the transaction pushed afterwards
+     * finds its keys in the cache. Unlike recover_in_parallel it throws on invalid or duplicate signatures.
+     * Returns the number of recovered signatures.
+     */
+    size_t prefetch(const signed_transaction& trx, const chain_id_type& chain_id);
+
+    void clear();
+
+    void set_enabled(bool enabled);
+    bool is_enabled() const;
+
+    stats get_stats() const;
+
+private:
+    static digest_type make_key(const digest_type& digest, const protocol::signature_type& sig);
+
+    public_key_type recover(const digest_type& digest, const protocol::signature_type& sig);
+    fc::optional<public_key_type> find(const digest_type& key) const;
+    void insert(const digest_type& key, const public_key_type& public_key);
+
+    mutable std::mutex _mutex;
+
+    std::map<digest_type, public_key_type> _keys;
+    std::deque<digest_type> _order;
+
+    size_t _max_size;
+    std::atomic<bool> _enabled{ true };
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+    uint64_t _prefetched = 0;
+
+    std::unique_ptr<worker_pool> _recovery_pool;
+};
+}
+}
+
+FC_REFLECT(scorum::chain::signature_cache::stats, (size)(hits)(misses)(prefetched)(hit_rate))
@@ -5,6 +5,8 @@
 #include <boost/type_index.hpp>
 #include <fc/log/logger.hpp>
 
+#include <scorum/chain/block_timing.hpp>
+
 namespace scorum {
 namespace chain {
 
@@ -32,6 +34,12 @@ public:
 
 struct data_service_factory_i;
 
+/// Contexts which collect timings of their tasks provide an overload of this function found by ADL
+template <typename ContextType> block_timing* get_block_timing(ContextType&)
+{
+    return nullptr;
+}
+
 template <typename ContextType = data_service_factory_i,
           typename ReentranceGuardType = dummy_reentrance_guard<ContextType>>
 class task
@@ -63,9 +71,18 @@ public:
             r.apply(ctx);
         }
 
-        auto impl = boost::typeindex::type_id_runtime(*this).pretty_name();
+        block_timing* timing = get_block_timing(ctx);
+        if (timing)
+        {
+            const std::string name = "task." + task_name();
+            block_timing_scope scope(timing, name.c_str());
 
-        on_apply(ctx);
+            on_apply(ctx);
+        }
+        else
+        {
+            on_apply(ctx);
+        }
 
         for (task& r : _before)
         {
@@ -76,6 +93,13 @@ public:
 protected:
     virtual void on_apply(ContextType&) = 0;
 
+    std::string task_name() const
+    {
+        auto name = boost::typeindex::type_id_runtime(*this).pretty_name();
+        auto pos = name.rfind("::");
+        return pos == std::string::npos ? name : name.substr(pos + 2);
+    }
+
 private:
     using tasks_reqired_type = std::vector<std::reference_wrapper<task>>;
 
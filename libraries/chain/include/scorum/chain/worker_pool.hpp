@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace scorum {
+namespace chain {
+
+/**
+ * Threads started once and reused for data parallel jobs, so a job run per block doesn't pay for thread creation.
+ * The calling thread takes a share of every job too, so the pool of N threads has N - 1 background workers. Only
+ * one job runs at a time.
+ */
+class worker_pool
+{
+public:
+    explicit worker_pool(uint32_t threads);
+    ~worker_pool();
+
+    worker_pool(const worker_pool&) = delete;
+    worker_pool& operator=(const worker_pool&) = delete;
+
+    /// the background workers and the calling thread
+    uint32_t size() const;
+
+    /// calls job, which must not throw, for every index of [0, count) on the workers and the calling thread,
+    /// returns when all are done
+    void run(size_t count, const std::function<void(size_t)>& job);
+
+private:
+    void work();
+    void take_indices();
+
+    std::vector<std::thread> _workers;
+
+    std::mutex _run_mutex;
+
+    std::mutex _mutex;
+    std::condition_variable _job_ready;
+    std::condition_variable _job_done;
+
+    const std::function<void(size_t)>* _job = nullptr;
+    size_t _count = 0;
+    std::atomic<size_t> _next{ 0 };
+    uint64_t _generation = 0;
+    uint32_t _busy = 0;
+    bool _stopped = false;
+};
+}
+}
@@ -0,0 +1,103 @@
+#include <scorum/chain/operation_timing.hpp>
+
+#include <scorum/protocol/operations.hpp>
+#include <scorum/protocol/operation_util_impl.hpp>
+
+namespace scorum {
+namespace chain {
+
+constexpr size_t operation_timing::buckets_count;
+
+namespace {
+
+size_t bucket_index(uint32_t microseconds)
+{
+    size_t index = 0;
+    while (microseconds && index < operation_timing::buckets_count - 1)
+    {
+        microseconds >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+uint32_t bucket_upper_bound(size_t index)
+{
+    return (uint32_t)1 << index;
+}
+}
+
+operation_timing::operation_timing()
+    : _samples(protocol::operation::count())
+{
+}
+
+void operation_timing::add(int which, uint32_t microseconds, bool failed)
+{
+    if (which < 0 || (size_t)which >= _samples.size())
+        return;
+
+    samples& s = _samples[which];
+
+    ++s.count;
+    if (failed)
+        ++s.failed;
+    s.total += microseconds;
+    s.max = std::max(s.max, microseconds);
+    ++s.histogram[bucket_index(microseconds)];
+}
+
+operation_timing::stats_map operation_timing::get_stats() const
+{
+    stats_map result;
+
+    for (size_t which = 0; which < _samples.size(); ++which)
+    {
+        const samples& s = _samples[which];
+        if (!s.count)
+            continue;
+
+        protocol::operation op;
+        op.set_which(which);
+
+        std::string name;
+        op.visit(fc::get_operation_name(name));
+
+        stats& st = result[name];
+        st.count = s.count;
+        st.failed = s.failed;
+        st.total = s.total;
+        st.mean = (uint32_t)(s.total / s.count);
+        st.max = s.max;
+        st.histogram.assign(s.histogram.begin(), s.histogram.end());
+
+        auto percentile = [&](uint64_t p) {
+            const uint64_t rank = (s.count * p + 99) / 100;
+            uint64_t passed = 0;
+            for (size_t i = 0; i < buckets_count; ++i)
+            {
+                passed += s.histogram[i];
+                if (passed >= rank)
+                    return std::min(bucket_upper_bound(i), s.max);
+            }
+            return s.max;
+        };
+
+        st.p50 = percentile(50);
+        st.p90 = percentile(90);
+        st.p99 = percentile(99);
+
+        // trailing empty buckets carry no information
+        while (!st.histogram.empty() && !st.histogram.back())
+            st.histogram.pop_back();
+    }
+
+    return result;
+}
+
+void operation_timing::clear()
+{
+    _samples.assign(_samples.size(), samples());
+}
+}
+}
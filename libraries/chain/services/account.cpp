@@ -21,6 +21,21 @@ dbs_account::dbs_account(dba::db_index& db, dynamic_global_property_service_i& d
 {
 }
 
+dbs_account::dbs_account(dba::db_index& db,
+                         dynamic_global_property_service_i& dgp_svc,
+                         witness_service_i& witness_svc,
+                         account_authority_cache& authority_cache)
+    : dbs_account(db, dgp_svc, witness_svc)
+{
+    _authority_cache = &authority_cache;
+}
+
+void dbs_account::on_authority_changed(const account_name_type& name)
+{
+    if (_authority_cache)
+        _authority_cache->on_changed(name);
+}
+
 const account_object& dbs_account::get(const account_id_type& account_id) const
 {
     try
@@ -128,6 +143,8 @@ const account_object& dbs_account::create_account(const account_name_type& new_a
             auth.posting = posting;
             auth.last_owner_update = fc::time_point_sec::min();
         });
+
+        on_authority_changed(new_account_name);
     }
 
     return new_account;
@@ -256,6 +273,8 @@ void dbs_account::update_acount(const account_object& account,
             if (posting)
                 auth.posting = *posting;
         });
+
+        on_authority_changed(account.name);
     }
 }
 
@@ -274,6 +293,8 @@ void dbs_account::update_owner_authority(const account_object& account, const au
                          auth.owner = owner_authority;
                          auth.last_owner_update = t;
                      });
+
+    on_authority_changed(account.name);
 }
 
 void dbs_account::increase_balance(const account_object& account, const asset& amount)
@@ -672,12 +693,12 @@ void dbs_account::adjust_proxied_witness_votes(const account_object& account, co
     }
 }
 
-dbs_account::account_refs_type dbs_account::get_active_sp_holders() const
+dbs_account::account_view_type dbs_account::get_active_sp_holders() const
 {
     fc::time_point_sec min_vote_time_for_cashout = _dgp_svc.head_block_time();
 
-    return get_range_by<by_voting_power_restoring_time>(min_vote_time_for_cashout < boost::lambda::_1,
-                                                        boost::multi_index::unbounded);
+    return get_range_view_by<by_voting_power_restoring_time>(min_vote_time_for_cashout < boost::lambda::_1,
+                                                             boost::multi_index::unbounded);
 }
 
 void dbs_account::foreach_account(account_call_type&& call) const
@@ -7,6 +7,9 @@
 
 #include <scorum/protocol/atomicswap_helper.hpp>
 
+#include <algorithm>
+#include <tuple>
+
 using namespace scorum::protocol;
 
 namespace scorum {
@@ -44,6 +47,24 @@ dbs_atomicswap::atomicswap_contracts_refs_type dbs_atomicswap::get_contracts(con
     return ret;
 }
 
+dbs_atomicswap::atomicswap_contracts_refs_type dbs_atomicswap::get_expired_contracts(const time_point_sec& now) const
+{
+    atomicswap_contracts_refs_type ret;
+
+    const auto& idx = db_impl().get_index<atomicswap_contract_index>().indices().get<by_deadline>();
+    for (auto it = idx.begin(); it != idx.end() && it->deadline <= now; ++it)
+    {
+        ret.push_back(std::cref(*it));
+    }
+
+    // expired contracts were always processed in by_owner_name order, their refund virtual operations keep it
+    std::sort(ret.begin(), ret.end(), [](const atomicswap_contract_object& lhs, const atomicswap_contract_object& rhs) {
+        return std::tie(lhs.owner, lhs.id) < std::tie(rhs.owner, rhs.id);
+    });
+
+    return ret;
+}
+
 const atomicswap_contract_object&
 dbs_atomicswap::get_contract(const account_object& from, const account_object& to, const std::string& secret_hash) const
 {
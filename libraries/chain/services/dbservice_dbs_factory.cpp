@@ -15,5 +15,10 @@ dbservice_dbs_factory::dbservice_dbs_factory(database& db)
 dbservice_dbs_factory::~dbservice_dbs_factory()
 {
 }
+
+account_authority_cache& dbservice_dbs_factory::authority_cache() const
+{
+    return _db_core.get_account_authority_cache();
+}
 }
 }
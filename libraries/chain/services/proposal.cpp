@@ -6,6 +6,7 @@ namespace chain {
 
 dbs_proposal::dbs_proposal(database& db)
     : base_service_type(db)
+    , _expiration_scheduler(db.get_expiration_scheduler())
 {
 }
 
@@ -52,10 +53,14 @@ void dbs_proposal::clear_expired_proposals()
 {
     const auto& proposal_expiration_index = db_impl().get_index<proposal_object_index>().indices().get<by_expiration>();
 
-    while (!proposal_expiration_index.empty() && is_expired(*proposal_expiration_index.begin()))
-    {
-        remove(*proposal_expiration_index.begin());
-    }
+    _expiration_scheduler.expire(expiration_type::proposal,
+                                 [&]() -> const proposal_object* {
+                                     return !proposal_expiration_index.empty()
+                                             && is_expired(*proposal_expiration_index.begin())
+                                         ? &*proposal_expiration_index.begin()
+                                         : nullptr;
+                                 },
+                                 [&](const proposal_object& proposal) { remove(proposal); });
 }
 
 void dbs_proposal::for_all_proposals_remove_from_voting_list(const account_name_type& member)
@@ -0,0 +1,229 @@
+#include <scorum/chain/signature_cache.hpp>
+
+#include <scorum/protocol/exceptions.hpp>
+
+#include <fc/io/raw.hpp>
+
+namespace scorum {
+namespace chain {
+
+signature_cache::signature_cache(size_t max_size)
+    : _max_size(max_size)
+{
+}
+
+fc::flat_set<public_key_type> signature_cache::get_signature_keys(const signed_transaction& trx,
+                                                                  const chain_id_type& chain_id)
+{
+    if (!_enabled)
+        return trx.get_signature_keys(chain_id);
+
+    try
+    {
+        auto d = trx.sig_digest(chain_id);
+        fc::flat_set<public_key_type> result;
+        for (const auto& sig : trx.signatures)
+        {
+            SCORUM_ASSERT(result.insert(recover(d, sig)).second, protocol::tx_duplicate_sig,
+                          "Duplicate Signature detected");
+        }
+        return result;
+    }
+    FC_CAPTURE_AND_RETHROW()
+}
+
+digest_type signature_cache::make_key(const digest_type& digest, const protocol::signature_type& sig)
+{
+    digest_type::encoder enc;
+    fc::raw::pack(enc, digest);
+    fc::raw::pack(enc, sig);
+    return enc.result();
+}
+
+public_key_type signature_cache::recover(const digest_type& digest, const protocol::signature_type& sig)
+{
+    auto key = make_key(digest, sig);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto it = _keys.find(key);
+        if (it != _keys.end())
+        {
+            ++_hits;
+            return it->second;
+        }
+
+        ++_misses;
+    }
+
+    public_key_type result = fc::ecc::public_key(sig, digest);
+    insert(key, result);
+
+    return result;
+}
+
+fc::optional<public_key_type> signature_cache::find(const digest_type& key) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _keys.find(key);
+    if (it == _keys.end())
+        return {};
+
+    return it->second;
+}
+
+void signature_cache::insert(const digest_type& key, const public_key_type& public_key)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (!_keys.emplace(key, public_key).second)
+        return;
+
+    _order.push_back(key);
+
+    if (_keys.size() > _max_size)
+    {
+        _keys.erase(_order.front());
+        _order.pop_front();
+    }
+}
+
+void signature_cache::set_recovery_threads(uint32_t threads)
+{
+    if (threads == get_recovery_threads())
+        return;
+
+    _recovery_pool.reset();
+    if (threads > 1)
+        _recovery_pool = std::make_unique<worker_pool>(threads);
+}
+
+uint32_t signature_cache::get_recovery_threads() const
+{
+    return _recovery_pool ? _recovery_pool->size() : 0;
+}
+
+size_t signature_cache::recover_in_parallel(const std::vector<signed_transaction>& trxs, const chain_id_type& chain_id)
+{
+    if (!_enabled || !_recovery_pool)
+        return 0;
+
+    struct job
+    {
+        digest_type key;
+        digest_type digest;
+        const protocol::signature_type* sig;
+        fc::optional<public_key_type> result;
+    };
+
+    std::vector<job> jobs;
+    for (const auto& trx : trxs)
+    {
+        auto d = trx.sig_digest(chain_id);
+        for (const auto& sig : trx.signatures)
+        {
+            auto key = make_key(d, sig);
+            if (!find(key).valid())
+                jobs.push_back({ key, d, &sig, {} });
+        }
+    }
+
+    if (jobs.empty())
+        return 0;
+
+    _recovery_pool->run(jobs.size(), [&](size_t i) {
+        try
+        {
+            jobs[i].result = public_key_type(fc::ecc::public_key(*jobs[i].sig, jobs[i].digest));
+        }
+        catch (...)
+        {
+        }
+    });
+
+    size_t recovered = 0;
+    for (const auto& j : jobs)
+    {
+        if (!j.result.valid())
+            continue;
+
+        insert(j.key, *j.result);
+        ++recovered;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _prefetched += recovered;
+
+    return recovered;
+}
+
+size_t signature_cache::prefetch(const signed_transaction& trx, const chain_id_type& chain_id)
+{
+    if (!_enabled)
+        return 0;
+
+    try
+    {
+        auto d = trx.sig_digest(chain_id);
+
+        fc::flat_set<public_key_type> keys;
+        size_t recovered = 0;
+        for (const auto& sig : trx.signatures)
+        {
+            auto key = make_key(d, sig);
+
+            auto cached = find(key);
+            if (!cached.valid())
+            {
+                cached = public_key_type(fc::ecc::public_key(sig, d));
+                insert(key, *cached);
+                ++recovered;
+            }
+
+            SCORUM_ASSERT(keys.insert(*cached).second, protocol::tx_duplicate_sig, "Duplicate Signature detected");
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _prefetched += recovered;
+
+        return recovered;
+    }
+    FC_CAPTURE_AND_RETHROW()
+}
+
+void signature_cache::clear()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _keys.clear();
+    _order.clear();
+}
+
+void signature_cache::set_enabled(bool enabled)
+{
+    _enabled = enabled;
+    clear();
+}
+
+bool signature_cache::is_enabled() const
+{
+    return _enabled;
+}
+
+signature_cache::stats signature_cache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    stats result;
+    result.size = _keys.size();
+    result.hits = _hits;
+    result.misses = _misses;
+    result.prefetched = _prefetched;
+    if (_hits + _misses > 0)
+        result.hit_rate = 100.0 * _hits / (_hits + _misses);
+    return result;
+}
+}
+}
@@ -0,0 +1,80 @@
+#include <scorum/chain/worker_pool.hpp>
+
+namespace scorum {
+namespace chain {
+
+worker_pool::worker_pool(uint32_t threads)
+{
+    for (uint32_t i = 1; i < threads; ++i)
+        _workers.emplace_back([this]() { work(); });
+}
+
+worker_pool::~worker_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _job_ready.notify_all();
+
+    for (auto& worker : _workers)
+        worker.join();
+}
+
+uint32_t worker_pool::size() const
+{
+    return static_cast<uint32_t>(_workers.size()) + 1;
+}
+
+void worker_pool::run(size_t count, const std::function<void(size_t)>& job)
+{
+    std::lock_guard<std::mutex> run_lock(_run_mutex);
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        _count = count;
+        _next = 0;
+        _busy = static_cast<uint32_t>(_workers.size());
+        ++_generation;
+    }
+    _job_ready.notify_all();
+
+    take_indices();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _job_done.wait(lock, [this]() { return _busy == 0; });
+    _job = nullptr;
+}
+
+void worker_pool::take_indices()
+{
+    for (size_t i = _next++; i < _count; i = _next++)
+        (*_job)(i);
+}
+
+void worker_pool::work()
+{
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _job_ready.wait(lock, [&]() { return _stopped || _generation != generation; });
+            if (_stopped)
+                return;
+            generation = _generation;
+        }
+
+        take_indices();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_busy;
+        }
+        _job_done.notify_one();
+    }
+}
+}
+}
@@ -0,0 +1,137 @@
+#include <chainbase/block_notification.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace chainbase {
+
+// the state is shared by processes, so the atomics must not need a lock
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2, "atomics in shared memory must be lock free");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32 bit integer");
+
+block_notifier::block_notifier(block_notification_state* state)
+    : _state(state)
+{
+}
+
+bool block_notifier::valid() const
+{
+    return _state != nullptr;
+}
+
+void block_notifier::notify(uint32_t block_num)
+{
+    if (!_state)
+        return;
+
+    uint32_t sequence = _state->sequence.load(std::memory_order_relaxed);
+
+    _state->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _state->block_num.store(block_num, std::memory_order_relaxed);
+    _state->notify_time_us.store(now_us(), std::memory_order_relaxed);
+
+    _state->sequence.store(sequence + 2, std::memory_order_release);
+
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_state->sequence), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+void block_notifier::recover()
+{
+    if (!_state)
+        return;
+
+    uint32_t sequence = _state->sequence.load(std::memory_order_relaxed);
+    if (sequence & 1)
+        _state->sequence.store(sequence + 1, std::memory_order_release);
+}
+
+block_notification block_notifier::read() const
+{
+    block_notification result;
+    if (!_state)
+        return result;
+
+    for (uint32_t attempt = 0; attempt < read_attempts; ++attempt)
+    {
+        uint32_t sequence = _state->sequence.load(std::memory_order_acquire);
+        if (sequence & 1)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        result.block_num = _state->block_num.load(std::memory_order_relaxed);
+        result.notify_time_us = _state->notify_time_us.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_state->sequence.load(std::memory_order_relaxed) == sequence)
+        {
+            result.sequence = sequence;
+            return result;
+        }
+    }
+
+    // the writer is gone or stuck in the middle of an update, the fields may be of different blocks
+    result.sequence = _state->sequence.load(std::memory_order_acquire) & ~1u;
+    result.block_num = _state->block_num.load(std::memory_order_relaxed);
+    result.notify_time_us = _state->notify_time_us.load(std::memory_order_relaxed);
+    return result;
+}
+
+block_notification block_notifier::wait(uint32_t last_sequence, std::chrono::microseconds timeout) const
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    while (_state)
+    {
+        uint32_t sequence = _state->sequence.load(std::memory_order_acquire);
+        if (sequence != last_sequence && !(sequence & 1))
+            break;
+
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+            break;
+
+        wait_for_change(sequence, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+    }
+
+    if (!_state)
+        std::this_thread::sleep_for(timeout);
+
+    return read();
+}
+
+void block_notifier::wait_for_change(uint32_t sequence, std::chrono::microseconds timeout) const
+{
+#ifdef __linux__
+    timespec ts;
+    ts.tv_sec = timeout.count() / 1000000;
+    ts.tv_nsec = (timeout.count() % 1000000) * 1000;
+
+    // not the private futex, the word is in a file mapping shared by processes
+    if (syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_state->sequence), FUTEX_WAIT, sequence, &ts, nullptr, 0) == 0
+        || errno == EAGAIN || errno == EINTR || errno == ETIMEDOUT)
+        return;
+#endif
+    std::this_thread::sleep_for(std::min(timeout, std::chrono::microseconds(1000)));
+}
+
+int64_t block_notifier::now_us()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+}
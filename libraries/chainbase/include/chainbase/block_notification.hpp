@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace chainbase {
+
+/**
+ * Seqlock which the writer process keeps in the shared memory file. The sequence is odd while the writer updates the
+ * fields and is increased by two for every block, so readers mapping the file read-only find out about new blocks
+ * without taking the interprocess lock.
+ */
+struct block_notification_state
+{
+    std::atomic<uint32_t> sequence{ 0 };
+    std::atomic<uint32_t> block_num{ 0 };
+    /// system clock of the writer, microseconds since epoch
+    std::atomic<int64_t> notify_time_us{ 0 };
+};
+
+struct block_notification
+{
+    uint32_t sequence = 0;
+    uint32_t block_num = 0;
+    int64_t notify_time_us = 0;
+};
+
+/**
+ * Access to the block_notification_state of a shared memory file. Waiting readers sleep on a futex on Linux and poll
+ * every millisecond elsewhere. Without the state (files created by former versions) reads return an empty
+ * notification and waits just time out.
+ */
+class block_notifier
+{
+public:
+    explicit block_notifier(block_notification_state* state = nullptr);
+
+    bool valid() const;
+
+    /// for the single writer process
+    void notify(uint32_t block_num);
+
+    /// for the writer process opening the file, completes an update left by a writer which died in the middle of it
+    void recover();
+
+    /// if the sequence stays odd for read_attempts, returns the fields with the last complete sequence
+    block_notification read() const;
+
+    static constexpr uint32_t read_attempts = 10000;
+
+    /// returns as soon as the sequence differs from last_sequence or after the timeout
+    block_notification wait(uint32_t last_sequence, std::chrono::microseconds timeout) const;
+
+    static int64_t now_us();
+
+private:
+    void wait_for_change(uint32_t sequence, std::chrono::microseconds timeout) const;
+
+    block_notification_state* _state = nullptr;
+};
+}
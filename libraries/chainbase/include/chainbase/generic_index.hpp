@@ -5,6 +5,7 @@
 
 #include <fc/shared_containers.hpp>
 
+#include <chainbase/index_keys.hpp>
 #include <chainbase/undo_session.hpp>
 
 namespace chainbase {
@@ -85,6 +86,31 @@ protected:
                 std::logic_error("Could not modify object, most likely a uniqueness constraint was violated"));
     }
 
+    /**
+    * Key-aware modify. 'original' must be a copy of 'obj' taken before the modification.
+    *
+    * The modifier is applied in place and the node is re-linked only if it changed a key of some index.
+    * Modifiers which touch non-key fields only (balances, counters, etc.) skip the per-index position checks
+    * that boost::multi_index::modify performs on every call.
+    */
+    template <typename Modifier> void modify(const value_type& obj, const value_type& original, Modifier&& m)
+    {
+        try
+        {
+            m(const_cast<value_type&>(obj));
+        }
+        catch (...)
+        {
+            // the modifier could leave a partially changed key behind, restore index consistency first
+            if (!detail::index_keys_equal(_indices, original, obj))
+                _indices.modify(_indices.iterator_to(obj), [](value_type&) {});
+            throw;
+        }
+
+        if (!detail::index_keys_equal(_indices, original, obj))
+            modify(obj, [](value_type&) {});
+    }
+
     auto remove(const value_type& obj)
     {
         return _indices.erase(_indices.iterator_to(obj));
@@ -169,7 +195,7 @@ public:
     {
         auto unmodified_copy = obj;
 
-        base_index_type::modify(obj, m);
+        base_index_type::modify(obj, unmodified_copy, m);
 
         on_modify(unmodified_copy);
     }
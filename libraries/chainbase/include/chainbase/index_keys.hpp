@@ -0,0 +1,92 @@
+#pragma once
+
+#include <type_traits>
+
+#include <boost/mpl/size.hpp>
+
+namespace chainbase {
+namespace detail {
+
+/**
+*  Compares the keys which the N-th index of a multi_index_container extracts from two values.
+*
+*  Ordered indices are compared through key_comp() (equivalence), hashed indices through key_eq().
+*  Indices without keys (sequenced, random_access) never require re-linking after a modify, so they are
+*  reported as unchanged.
+*/
+template <typename Index> class index_key_cmp
+{
+    template <typename T> static auto has_key_comp(int) -> decltype(std::declval<T>().key_comp(), std::true_type());
+    template <typename T> static std::false_type has_key_comp(...);
+
+    template <typename T> static auto has_key_eq(int) -> decltype(std::declval<T>().key_eq(), std::true_type());
+    template <typename T> static std::false_type has_key_eq(...);
+
+    using ordered = decltype(has_key_comp<const Index&>(0));
+    using hashed = decltype(has_key_eq<const Index&>(0));
+
+    template <typename Value, typename Hashed>
+    static bool equal(const Index& idx, const Value& a, const Value& b, std::true_type, Hashed)
+    {
+        const auto& key = idx.key_extractor();
+        const auto& comp = idx.key_comp();
+        return !comp(key(a), key(b)) && !comp(key(b), key(a));
+    }
+
+    template <typename Value>
+    static bool equal(const Index& idx, const Value& a, const Value& b, std::false_type, std::true_type)
+    {
+        const auto& key = idx.key_extractor();
+        return idx.key_eq()(key(a), key(b));
+    }
+
+    template <typename Value>
+    static bool equal(const Index&, const Value&, const Value&, std::false_type, std::false_type)
+    {
+        return true;
+    }
+
+public:
+    template <typename Value> static bool equal(const Index& idx, const Value& a, const Value& b)
+    {
+        return equal(idx, a, b, ordered(), hashed());
+    }
+};
+
+template <typename MultiIndexType, int N, int Size> struct index_keys_cmp
+{
+    template <typename Value> static bool equal(const MultiIndexType& indices, const Value& a, const Value& b)
+    {
+        using index_type = typename MultiIndexType::template nth_index<N>::type;
+
+        if (!index_key_cmp<index_type>::equal(indices.template get<N>(), a, b))
+            return false;
+
+        return index_keys_cmp<MultiIndexType, N + 1, Size>::equal(indices, a, b);
+    }
+};
+
+template <typename MultiIndexType, int Size> struct index_keys_cmp<MultiIndexType, Size, Size>
+{
+    template <typename Value> static bool equal(const MultiIndexType&, const Value&, const Value&)
+    {
+        return true;
+    }
+};
+
+/**
+*  Returns true if every index of the container extracts equivalent keys from both values, i.e. replacing
+*  'a' with 'b' in place leaves the container consistent without re-linking any node.
+*/
+template <typename MultiIndexType>
+bool index_keys_equal(const MultiIndexType& indices,
+                      const typename MultiIndexType::value_type& a,
+                      const typename MultiIndexType::value_type& b)
+{
+    constexpr int size = boost::mpl::size<typename MultiIndexType::index_type_list>::value;
+
+    return index_keys_cmp<MultiIndexType, 0, size>::equal(indices, a, b);
+}
+
+} // namespace detail
+} // namespace chainbase
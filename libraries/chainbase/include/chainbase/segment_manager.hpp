@@ -2,6 +2,7 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <chainbase/block_notification.hpp>
 #include <chainbase/generic_index.hpp>
 
 namespace chainbase {
@@ -13,11 +14,16 @@ protected:
 
     std::unique_ptr<boost::interprocess::managed_mapped_file> _segment;
 
+    block_notification_state* _block_notification = nullptr;
+
 public:
     size_t get_free_memory() const;
 
     size_t get_size() const;
 
+    /// the writer notifies about applied blocks, read-only processes wait for them
+    block_notifier get_block_notifier() const;
+
 protected:
     void create_segment_file(const boost::filesystem::path& file, bool read_only, uint64_t shared_file_size);
 
@@ -25,18 +31,19 @@ protected:
 
     void close_segment_file();
 
+    /// indices are found by the object type name, so a file written with other indices of the object is refused
+    void check_index_layout(const std::string& type_name, const std::string& layout, bool created);
+
     template <typename index_type> index_type* allocate_index()
     {
         std::string type_name = boost::core::demangle(typeid(typename index_type::value_type).name());
 
-        index_type* idx_ptr = nullptr;
-        if (!_read_only)
+        index_type* idx_ptr = _segment->find<index_type>(type_name.c_str()).first;
+        bool created = false;
+        if (!idx_ptr && !_read_only)
         {
-            idx_ptr = _segment->find_or_construct<index_type>(type_name.c_str())(_segment->get_segment_manager());
-        }
-        else
-        {
-            idx_ptr = _segment->find<index_type>(type_name.c_str()).first;
+            idx_ptr = _segment->construct<index_type>(type_name.c_str())(_segment->get_segment_manager());
+            created = true;
         }
 
         // clang-format off
@@ -44,6 +51,8 @@ protected:
             BOOST_THROW_EXCEPTION(std::runtime_error("unable to find index for " + type_name + " in read " + (_read_only ? "only" : "/ write") + " database"));
         // clang-format on
 
+        check_index_layout(type_name, boost::core::demangle(typeid(index_type).name()), created);
+
         return idx_ptr;
     }
 };
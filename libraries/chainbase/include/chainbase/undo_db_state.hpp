@@ -6,6 +6,8 @@
 
 namespace chainbase {
 
+struct session_container;
+
 class undo_db_state : public database_index<segment_manager>
 {
 public:
@@ -19,5 +21,14 @@ public:
     }
 
     abstract_undo_session_ptr start_undo_session();
+
+protected:
+    /// called after changes of a session returned by start_undo_session() were undone
+    virtual void on_undo()
+    {
+    }
+
+private:
+    friend struct session_container;
 };
 }
@@ -81,6 +81,41 @@ void segment_manager::create_segment_file(const boost::filesystem::path& file,
                                                                     file.generic_string().c_str(), shared_file_size));
         _segment->construct<environment_check>("environment")();
     }
+
+    // files created by former versions get the state when the writer opens them
+    if (read_only)
+        _block_notification = _segment->find<block_notification_state>("block_notification").first;
+    else
+    {
+        _block_notification = _segment->find_or_construct<block_notification_state>("block_notification")();
+        get_block_notifier().recover();
+    }
+}
+
+void segment_manager::check_index_layout(const std::string& type_name, const std::string& layout, bool created)
+{
+    // FNV-1a, the hash must not change between builds
+    uint64_t layout_hash = 14695981039346656037ull;
+    for (unsigned char c : layout)
+    {
+        layout_hash ^= c;
+        layout_hash *= 1099511628211ull;
+    }
+
+    std::string layout_name = type_name + " layout";
+    auto stored = _segment->find<uint64_t>(layout_name.c_str()).first;
+    if (!stored && created)
+    {
+        _segment->construct<uint64_t>(layout_name.c_str())(layout_hash);
+        return;
+    }
+
+    // files written by former versions have no layouts at all
+    if (!stored || *stored != layout_hash)
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error("index layout for " + type_name
+                                                 + " differs from the database file, replay the blockchain"));
+    }
 }
 
 void segment_manager::flush_segment_file()
@@ -91,6 +126,7 @@ void segment_manager::flush_segment_file()
 
 void segment_manager::close_segment_file()
 {
+    _block_notification = nullptr;
     _segment.reset();
 }
 
@@ -100,6 +136,11 @@ size_t segment_manager::get_free_memory() const
     return _segment->get_segment_manager()->get_free_memory();
 }
 
+block_notifier segment_manager::get_block_notifier() const
+{
+    return block_notifier(_block_notification);
+}
+
 size_t segment_manager::get_size() const
 {
     FC_ASSERT(_segment);
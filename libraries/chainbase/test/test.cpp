@@ -8,6 +8,10 @@
 #include <boost/multi_index/member.hpp>
 
 #include <iostream>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace boost::multi_index;
 
@@ -30,6 +34,12 @@ typedef fc::shared_multi_index_container<book,
 
 CHAINBASE_SET_INDEX_TYPE(book, book_index)
 
+/// book_index of a former version, without the index by b
+typedef fc::shared_multi_index_container<book,
+                                         indexed_by<ordered_unique<member<book, book::id_type, &book::id>>,
+                                                    ordered_non_unique<BOOST_MULTI_INDEX_MEMBER(book, int, a)>>>
+    former_book_index;
+
 class moc_database : public chainbase::database
 {
     typedef chainbase::database _Base;
@@ -44,6 +54,14 @@ public:
         for_each_index([&](chainbase::abstract_generic_index_i& item) { item.undo(); });
     }
 
+    int undone_sessions = 0;
+
+protected:
+    void on_undo() override
+    {
+        ++undone_sessions;
+    }
+
     // TODO (if chainbase::database became private)
 };
 
@@ -146,4 +164,305 @@ BOOST_AUTO_TEST_CASE(open_and_create)
     }
 }
 
+BOOST_AUTO_TEST_CASE(modify_reindexes_only_changed_keys)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<book_index>();
+
+        const auto& book1 = db.create<book>([](book& b) {
+            b.a = 1;
+            b.b = 1;
+        });
+        const auto& book2 = db.create<book>([](book& b) {
+            b.a = 2;
+            b.b = 2;
+        });
+
+        const auto& by_a = db.get_index<book_index>().indices().get<1>();
+
+        db.modify(book1, [&](book& b) { b.a = 3; });
+
+        BOOST_REQUIRE_EQUAL(by_a.begin()->id._id, book2.id._id);
+        BOOST_REQUIRE_EQUAL(by_a.rbegin()->id._id, book1.id._id);
+        BOOST_REQUIRE(by_a.find(3) != by_a.end());
+        BOOST_REQUIRE(by_a.find(1) == by_a.end());
+
+        {
+            auto session = db.start_undo_session();
+            db.modify(book2, [&](book& b) { b.a = 4; });
+
+            BOOST_REQUIRE_EQUAL(by_a.rbegin()->id._id, book2.id._id);
+        }
+
+        BOOST_REQUIRE_EQUAL(book2.a, 2);
+        BOOST_REQUIRE_EQUAL(by_a.begin()->id._id, book2.id._id);
+        BOOST_REQUIRE(by_a.find(4) == by_a.end());
+
+        BOOST_CHECK_THROW(db.modify(book1,
+                                    [&](book& b) {
+                                        b.a = 5;
+                                        throw std::runtime_error("modifier failed");
+                                    }),
+                          std::runtime_error);
+
+        BOOST_REQUIRE(by_a.find(5) != by_a.end());
+        BOOST_REQUIRE(by_a.find(3) == by_a.end());
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+    boost::filesystem::remove_all(temp);
+}
+
 // BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_CASE(undo_hook_is_called_for_discarded_sessions_only)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        db.add_index<book_index>();
+
+        {
+            auto session = db.start_undo_session();
+            db.create<book>([](book& b) { b.a = 1; });
+            session->push();
+        }
+        BOOST_REQUIRE_EQUAL(db.undone_sessions, 0);
+
+        {
+            auto session = db.start_undo_session();
+            db.create<book>([](book& b) { b.a = 2; });
+        }
+        BOOST_REQUIRE_EQUAL(db.undone_sessions, 1);
+        BOOST_CHECK_THROW(db.get(book::id_type(1)), std::out_of_range);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(changed_index_layout_is_refused)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        {
+            moc_database db;
+            db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+            db.add_index<former_book_index>();
+            db.close();
+        }
+
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        BOOST_CHECK_THROW(db.add_index<book_index>(), std::runtime_error);
+
+        moc_database replica;
+        replica.open(temp);
+        BOOST_CHECK_THROW(replica.add_index<book_index>(), std::runtime_error);
+        BOOST_CHECK_NO_THROW(replica.add_index<former_book_index>());
+
+        replica.close();
+        db.close();
+        boost::filesystem::remove_all(temp);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_notification_is_seen_by_read_only_database)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+
+        moc_database replica;
+        replica.open(temp);
+
+        auto writer = db.get_block_notifier();
+        auto reader = replica.get_block_notifier();
+        BOOST_REQUIRE(writer.valid());
+        BOOST_REQUIRE(reader.valid());
+
+        auto initial = reader.read();
+        BOOST_CHECK_EQUAL(initial.block_num, 0u);
+
+        writer.notify(10);
+        writer.notify(11);
+
+        auto last = reader.read();
+        BOOST_CHECK_EQUAL(last.block_num, 11u);
+        BOOST_CHECK_EQUAL(last.sequence, initial.sequence + 4);
+        BOOST_CHECK_GT(last.notify_time_us, 0);
+
+        // the sequence has changed already, so there is nothing to wait for
+        BOOST_CHECK_EQUAL(reader.wait(initial.sequence, std::chrono::seconds(10)).block_num, 11u);
+
+        replica.close();
+        BOOST_CHECK(!replica.get_block_notifier().valid());
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_notification_wait_times_out)
+{
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+
+        auto notifier = db.get_block_notifier();
+        auto last = notifier.read();
+
+        auto started = std::chrono::steady_clock::now();
+        auto result = notifier.wait(last.sequence, std::chrono::milliseconds(50));
+
+        BOOST_CHECK_EQUAL(result.sequence, last.sequence);
+        BOOST_CHECK(std::chrono::steady_clock::now() - started >= std::chrono::milliseconds(50));
+
+        std::thread writer([&]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            notifier.notify(1);
+        });
+        result = notifier.wait(last.sequence, std::chrono::seconds(10));
+        writer.join();
+
+        BOOST_CHECK_EQUAL(result.block_num, 1u);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(block_notification_survives_interrupted_update)
+{
+    // a writer died between the two sequence stores of notify
+    chainbase::block_notification_state state;
+    state.sequence = 5;
+    state.block_num = 3;
+
+    chainbase::block_notifier notifier(&state);
+
+    auto interrupted = notifier.read();
+    BOOST_CHECK_EQUAL(interrupted.sequence, 4u);
+    BOOST_CHECK_EQUAL(interrupted.block_num, 3u);
+
+    notifier.recover();
+    BOOST_CHECK_EQUAL(notifier.read().sequence, 6u);
+
+    notifier.notify(4);
+    auto last = notifier.read();
+    BOOST_CHECK_EQUAL(last.sequence, 8u);
+    BOOST_CHECK_EQUAL(last.block_num, 4u);
+}
+
+BOOST_AUTO_TEST_CASE(block_notification_wakes_read_only_process)
+{
+    const uint32_t blocks_count = 50;
+
+    boost::filesystem::path temp = boost::filesystem::unique_path();
+    try
+    {
+        moc_database db;
+        db.open(temp, chainbase::database::read_write, 1024 * 1024 * 8);
+        auto writer = db.get_block_notifier();
+
+        int ready[2];
+        int results[2];
+        BOOST_REQUIRE_EQUAL(pipe(ready), 0);
+        BOOST_REQUIRE_EQUAL(pipe(results), 0);
+
+        pid_t pid = fork();
+        BOOST_REQUIRE(pid >= 0);
+        if (pid == 0)
+        {
+            // the read only process, it reports back through the pipe and never returns to the test runner
+            int64_t stats[4] = { 0, 0, 0, 0 }; // seen, total latency, max latency, last block
+            try
+            {
+                moc_database replica;
+                replica.open(temp);
+                auto reader = replica.get_block_notifier();
+
+                auto last = reader.read();
+                char byte = 1;
+                if (write(ready[1], &byte, 1) != 1)
+                    _exit(1);
+
+                while (last.block_num < blocks_count)
+                {
+                    auto notification = reader.wait(last.sequence, std::chrono::seconds(5));
+                    if (notification.sequence == last.sequence)
+                        break;
+
+                    int64_t latency = chainbase::block_notifier::now_us() - notification.notify_time_us;
+                    ++stats[0];
+                    stats[1] += latency;
+                    stats[2] = std::max(stats[2], latency);
+                    last = notification;
+                }
+                stats[3] = last.block_num;
+            }
+            catch (...)
+            {
+            }
+            _exit(write(results[1], stats, sizeof(stats)) == sizeof(stats) ? 0 : 1);
+        }
+
+        char byte = 0;
+        BOOST_REQUIRE_EQUAL(read(ready[0], &byte, 1), 1);
+
+        for (uint32_t block_num = 1; block_num <= blocks_count; ++block_num)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            writer.notify(block_num);
+        }
+
+        int status = 0;
+        BOOST_REQUIRE_EQUAL(waitpid(pid, &status, 0), pid);
+        BOOST_REQUIRE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+        int64_t stats[4] = { 0, 0, 0, 0 };
+        BOOST_REQUIRE_EQUAL(read(results[0], stats, sizeof(stats)), (ssize_t)sizeof(stats));
+
+        for (int fd : { ready[0], ready[1], results[0], results[1] })
+            close(fd);
+
+        BOOST_TEST_MESSAGE("read only process saw " << stats[0] << " of " << blocks_count
+                                                    << " blocks, average latency "
+                                                    << (stats[0] ? stats[1] / stats[0] : 0) << "us, max latency "
+                                                    << stats[2] << "us");
+
+        // blocks announced while the reader is busy are merged, but the reader always gets to the last one
+        BOOST_CHECK_GT(stats[0], 0);
+        BOOST_CHECK_EQUAL(stats[3], (int64_t)blocks_count);
+    }
+    catch (...)
+    {
+        boost::filesystem::remove_all(temp);
+        throw;
+    }
+}
@@ -11,16 +11,30 @@ struct session_container : public abstract_undo_session
 private:
     friend class undo_db_state;
 
+    undo_db_state& _db;
+    bool _pushed = false;
+
 public:
-    session_container(abstract_undo_session_list&& s)
+    session_container(undo_db_state& db, abstract_undo_session_list&& s)
         : _session_list(std::move(s))
+        , _db(db)
     {
     }
 
+    ~session_container()
+    {
+        if (_pushed)
+            return;
+
+        _session_list.clear();
+        _db.on_undo();
+    }
+
     virtual void push() override
     {
         for (auto& i : _session_list)
             i->push();
+        _pushed = true;
     }
 };
 
@@ -32,6 +46,6 @@ abstract_undo_session_ptr undo_db_state::start_undo_session()
 
     for_each_index([&](abstract_generic_index_i& item) { sub_sessions.push_back(item.start_undo_session()); });
 
-    return abstract_undo_session_ptr(new session_container(std::move(sub_sessions)));
+    return abstract_undo_session_ptr(new session_container(*this, std::move(sub_sessions)));
 }
 }
@@ -23,11 +23,19 @@
  */
 #include <graphene/net/core_messages.hpp>
 
+#include <zlib.h>
+
 namespace graphene {
 namespace net {
 
 const core_message_type_enum trx_message::type = core_message_type_enum::trx_message_type;
 const core_message_type_enum block_message::type = core_message_type_enum::block_message_type;
+const core_message_type_enum compact_block_message::type = core_message_type_enum::compact_block_message_type;
+const core_message_type_enum fetch_compact_block_transactions_message::type
+    = core_message_type_enum::fetch_compact_block_transactions_message_type;
+const core_message_type_enum compact_block_transactions_message::type
+    = core_message_type_enum::compact_block_transactions_message_type;
+const core_message_type_enum compressed_message::type = core_message_type_enum::compressed_message_type;
 const core_message_type_enum item_ids_inventory_message::type = core_message_type_enum::item_ids_inventory_message_type;
 const core_message_type_enum blockchain_item_ids_inventory_message::type
     = core_message_type_enum::blockchain_item_ids_inventory_message_type;
@@ -53,5 +61,63 @@ const core_message_type_enum get_current_connections_request_message::type
     = core_message_type_enum::get_current_connections_request_message_type;
 const core_message_type_enum get_current_connections_reply_message::type
     = core_message_type_enum::get_current_connections_reply_message_type;
+
+compact_block_message::compact_block_message(const item_hash_t& item_hash, const signed_block& blk)
+    : item_hash(item_hash)
+    , header(blk)
+{
+    const block_id_type block_id = blk.id();
+
+    short_transaction_ids.reserve(blk.transactions.size());
+    for (const auto& trx : blk.transactions)
+        short_transaction_ids.push_back(short_transaction_id(block_id, trx.id()));
+}
+
+short_transaction_id_type compact_block_message::short_transaction_id(const block_id_type& block_id,
+                                                                     const transaction_id_type& trx_id)
+{
+    fc::sha256::encoder enc;
+    fc::raw::pack(enc, block_id);
+    fc::raw::pack(enc, trx_id);
+    return enc.result()._hash[0];
+}
+
+fc::optional<message> compress_message(const message& message_to_compress)
+{
+    compressed_message envelope;
+    envelope.msg_type = message_to_compress.msg_type;
+    envelope.uncompressed_size = message_to_compress.size;
+
+    uLongf compressed_size = compressBound(message_to_compress.data.size());
+    envelope.data.resize(compressed_size);
+    int rc = compress2((Bytef*)envelope.data.data(), &compressed_size, (const Bytef*)message_to_compress.data.data(),
+                       message_to_compress.data.size(), Z_BEST_SPEED);
+    FC_ASSERT(rc == Z_OK, "unable to compress message: zlib error ${rc}", ("rc", rc));
+    envelope.data.resize(compressed_size);
+
+    message compressed(envelope);
+    if (compressed.size >= message_to_compress.size)
+        return fc::optional<message>();
+    return compressed;
+}
+
+message decompress_message(const message& compressed)
+{
+    compressed_message envelope = compressed.as<compressed_message>();
+    FC_ASSERT(envelope.msg_type != compressed_message::type, "nested compressed messages are not allowed");
+    FC_ASSERT(envelope.uncompressed_size <= MAX_MESSAGE_SIZE, "",
+              ("uncompressed_size", envelope.uncompressed_size)("MAX_MESSAGE_SIZE", MAX_MESSAGE_SIZE));
+
+    message result;
+    result.msg_type = envelope.msg_type;
+    result.size = envelope.uncompressed_size;
+    result.data.resize(envelope.uncompressed_size);
+
+    uLongf uncompressed_size = envelope.uncompressed_size;
+    int rc = uncompress((Bytef*)result.data.data(), &uncompressed_size, (const Bytef*)envelope.data.data(),
+                        envelope.data.size());
+    FC_ASSERT(rc == Z_OK && uncompressed_size == envelope.uncompressed_size,
+              "unable to decompress message: zlib error ${rc}", ("rc", rc)("uncompressed_size", uncompressed_size));
+    return result;
 }
 } // graphene::net
@@ -45,6 +45,18 @@
  */
 #define GRAPHENE_PEER_DATABASE_RETRY_DELAY 15 // seconds
 
+/**
+ * The peer database file is a log of updated and erased records, it is rewritten with the current records only
+ * when it has more records than this or twice the number of peers, whichever is larger.
+ */
+#define GRAPHENE_PEER_DATABASE_MIN_COMPACTION_RECORDS 1024
+
+/**
+ * Changes of the peer database are kept in memory and appended to its file at most once per this interval, the node
+ * flushes them periodically as well and on close.
+ */
+#define GRAPHENE_PEER_DATABASE_FLUSH_INTERVAL 10 // seconds
+
 #define GRAPHENE_NET_PEER_HANDSHAKE_INACTIVITY_TIMEOUT 5
 
 #define GRAPHENE_NET_PEER_DISCONNECT_TIMEOUT 20
@@ -57,6 +69,21 @@
 
 #define GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES (1024 * 1024)
 
+/**
+ * Part of the send queue of a peer which item inventory advertisements may take. Advertisements over it are dropped,
+ * so a burst of new items can't delay blocks or make us disconnect the peer.
+ */
+#define GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES (256 * 1024)
+
+/**
+ * Transactions a peer may send per second and at once after being idle, the ones over the limit are dropped. The
+ * transactions let in wait for the delegate in per-peer queues which are served in turn.
+ */
+#define GRAPHENE_NET_DEFAULT_PEER_TRANSACTIONS_PER_SECOND 200
+#define GRAPHENE_NET_DEFAULT_PEER_TRANSACTIONS_BURST 1000
+#define GRAPHENE_NET_DEFAULT_PEER_MAX_QUEUED_TRANSACTIONS 1000
+#define GRAPHENE_NET_DEFAULT_TRANSACTIONS_TO_HANDLE_AT_ONE_TIME 4
+
 /**
  * When we receive a message from the network, we advertise it to
  * our peers and save a copy in a cache were we will find it if
@@ -103,3 +130,10 @@
 #define GRAPHENE_NET_MIN_BLOCK_IDS_TO_PREFETCH 10000
 
 #define GRAPHENE_NET_MAX_TRX_PER_SECOND 1000
+
+/**
+ * Messages smaller than this are sent uncompressed even to peers which support
+ * compression: small transactions and control messages don't compress well enough
+ * to pay for the cpu time.  Setting the threshold to 0 disables compression.
+ */
+#define GRAPHENE_NET_MESSAGE_COMPRESSION_THRESHOLD 512
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <graphene/net/config.hpp>
+#include <graphene/net/message.hpp>
 #include <scorum/protocol/block.hpp>
 
 #include <fc/crypto/ripemd160.hpp>
@@ -35,6 +36,7 @@
 #include <fc/variant_object.hpp>
 #include <fc/exception/exception.hpp>
 #include <fc/io/enum_type.hpp>
+#include <fc/optional.hpp>
 
 #include <vector>
 
@@ -83,6 +85,10 @@ enum core_message_type_enum
     check_firewall_reply_message_type = 5015,
     get_current_connections_request_message_type = 5016,
     get_current_connections_reply_message_type = 5017,
+    compact_block_message_type = 5018,
+    fetch_compact_block_transactions_message_type = 5019,
+    compact_block_transactions_message_type = 5020,
+    compressed_message_type = 5021,
     core_message_type_last = 5099
 };
 
@@ -115,6 +121,86 @@ struct block_message
     block_id_type block_id;
 };
 
+typedef uint64_t short_transaction_id_type;
+
+/**
+ * Block header plus short ids of the block transactions. Sent instead of block_message
+ * to peers which requested blocks with item_type == compact_block_message_type.
+ * The receiver rebuilds the block from transactions in its message cache and asks
+ * for the missing ones with fetch_compact_block_transactions_message.
+ */
+struct compact_block_message
+{
+    static const core_message_type_enum type;
+
+    compact_block_message() {}
+    compact_block_message(const item_hash_t& item_hash, const signed_block& blk);
+
+    /**
+     * Short ids are salted with the block id, so transactions colliding in one block
+     * don't collide in the others
+     */
+    static short_transaction_id_type short_transaction_id(const block_id_type& block_id,
+                                                          const transaction_id_type& trx_id);
+
+    /// hash of the full block_message, as advertised in the inventory
+    item_hash_t item_hash;
+    scorum::protocol::signed_block_header header;
+    std::vector<short_transaction_id_type> short_transaction_ids;
+};
+
+struct fetch_compact_block_transactions_message
+{
+    static const core_message_type_enum type;
+
+    fetch_compact_block_transactions_message() {}
+    fetch_compact_block_transactions_message(const item_hash_t& item_hash,
+                                             const block_id_type& block_id,
+                                             const std::vector<uint32_t>& indexes)
+        : item_hash(item_hash)
+        , block_id(block_id)
+        , indexes(indexes)
+    {
+    }
+
+    item_hash_t item_hash;
+    block_id_type block_id;
+    /// positions of the missing transactions in the block
+    std::vector<uint32_t> indexes;
+};
+
+struct compact_block_transactions_message
+{
+    static const core_message_type_enum type;
+
+    item_hash_t item_hash;
+    std::vector<signed_transaction> transactions;
+};
+
+/**
+ * Envelope for a zlib-compressed message. Only sent to peers which advertised "compression"
+ * in the user_data of their hello message, and only for messages at least as large as the
+ * connection's compression threshold. message_oriented_connection unwraps it before the
+ * message reaches the node, so message ids are always computed over the uncompressed data.
+ */
+struct compressed_message
+{
+    static const core_message_type_enum type;
+
+    uint32_t msg_type = 0;
+    uint32_t uncompressed_size = 0;
+    std::vector<char> data;
+};
+
+/**
+ * Returns the compressed_message envelope for @p message_to_compress, or an invalid optional
+ * if compression would not make the message smaller.
+ */
+fc::optional<message> compress_message(const message& message_to_compress);
+
+/// Restores the original message from a compressed_message envelope
+message decompress_message(const message& compressed);
+
 struct item_ids_inventory_message
 {
     static const core_message_type_enum type;
@@ -443,10 +529,18 @@ FC_REFLECT_ENUM(
         (check_firewall_reply_message_type)
         (get_current_connections_request_message_type)
         (get_current_connections_reply_message_type)
+        (compact_block_message_type)
+        (fetch_compact_block_transactions_message_type)
+        (compact_block_transactions_message_type)
+        (compressed_message_type)
         (core_message_type_last))
 
 FC_REFLECT(graphene::net::trx_message, (trx))
 FC_REFLECT(graphene::net::block_message, (block)(block_id))
+FC_REFLECT(graphene::net::compact_block_message, (item_hash)(header)(short_transaction_ids))
+FC_REFLECT(graphene::net::fetch_compact_block_transactions_message, (item_hash)(block_id)(indexes))
+FC_REFLECT(graphene::net::compact_block_transactions_message, (item_hash)(transactions))
+FC_REFLECT(graphene::net::compressed_message, (msg_type)(uncompressed_size)(data))
 
 FC_REFLECT(graphene::net::item_id, (item_type)(item_hash))
 FC_REFLECT(graphene::net::item_ids_inventory_message, (item_type)(item_hashes_available))
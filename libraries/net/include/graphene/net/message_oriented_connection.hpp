@@ -55,11 +55,16 @@ public:
     void connect_to(const fc::ip::endpoint& remote_endpoint);
 
     void send_message(const message& message_to_send);
+    /** compress outgoing messages of at least @p threshold bytes, the remote end must have advertised support */
+    void enable_compression(uint32_t threshold);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    /** bytes compression kept off the wire, compared to sending the messages uncompressed */
+    uint64_t get_total_bytes_saved_sending() const;
+    uint64_t get_total_bytes_saved_receiving() const;
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
     fc::time_point get_connection_time() const;
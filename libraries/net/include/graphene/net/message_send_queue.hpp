@@ -0,0 +1,212 @@
+#pragma once
+
+#include <graphene/net/config.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/reflect/reflect.hpp>
+#include <fc/time.hpp>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace graphene {
+namespace net {
+
+/// classes of outbound messages, a class is sent only when all classes before it are empty
+enum class message_priority
+{
+    block = 0,
+    sync,
+    inventory,
+    advertisement,
+    transaction
+};
+
+const size_t message_priorities_count = 5;
+
+/**
+ * Blocks, compact blocks and the connection protocol messages are blocks, requests and replies of block ids are
+ * sync, fetch requests and their not available replies are inventory, item inventories are advertisement.
+ */
+message_priority get_message_priority(uint32_t msg_type);
+
+std::string to_string(message_priority priority);
+
+struct send_queue_budget
+{
+    size_t max_bytes = GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES;
+
+    /// messages over the budget are dropped, otherwise the queue overflows and the connection is closed
+    bool drop_over_budget = false;
+};
+
+struct send_queue_stats
+{
+    uint64_t queued_messages = 0;
+    uint64_t queued_bytes = 0;
+    uint64_t max_queued_bytes = 0;
+    uint64_t sent_messages = 0;
+    uint64_t dropped_messages = 0;
+
+    /// from queueing to the start of transmission
+    uint64_t total_wait_us = 0;
+    uint64_t max_wait_us = 0;
+};
+
+/**
+ * Outbound queue of a peer connection.
+ *
+ * Messages of a class are sent in FIFO order, classes are sent in message_priority order, so blocks don't wait
+ * behind a backlog of transactions. Each class has its own byte budget, all of them together are limited by
+ * GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES. Advertisements are unsolicited and dropped over their budget, the
+ * peer may learn about the items from other peers. Replies to fetch_items, transactions among them, are solicited and
+ * never dropped, the requester disconnects when a requested item doesn't arrive in time, they are limited by the
+ * total budget only. Any other class over its budget means the peer doesn't keep up and is disconnected as before.
+ */
+template <typename TMessage> class message_send_queue
+{
+public:
+    using message_ptr = std::unique_ptr<TMessage>;
+
+    enum class push_result
+    {
+        queued,
+        dropped,
+        overflow
+    };
+
+    message_send_queue()
+    {
+        send_queue_budget advertisements;
+        advertisements.max_bytes = GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES;
+        advertisements.drop_over_budget = true;
+
+        set_budget(message_priority::advertisement, advertisements);
+    }
+
+    void set_budget(message_priority priority, const send_queue_budget& budget)
+    {
+        _budgets[(size_t)priority] = budget;
+    }
+
+    push_result
+    push(message_priority priority, message_ptr msg, size_t size, fc::time_point now = fc::time_point::now())
+    {
+        const auto& budget = _budgets[(size_t)priority];
+        auto& stats = _stats[(size_t)priority];
+
+        if (stats.queued_bytes + size > budget.max_bytes || _total_bytes + size > _max_total_bytes)
+        {
+            if (!budget.drop_over_budget)
+                return push_result::overflow;
+
+            ++stats.dropped_messages;
+            return push_result::dropped;
+        }
+
+        return enqueue(priority, std::move(msg), size, now);
+    }
+
+    /// queues a reply to a fetch request, it is never dropped and overflows only the total budget
+    push_result push_solicited(message_priority priority,
+                               message_ptr msg,
+                               size_t size,
+                               fc::time_point now = fc::time_point::now())
+    {
+        if (_total_bytes + size > _max_total_bytes)
+            return push_result::overflow;
+
+        return enqueue(priority, std::move(msg), size, now);
+    }
+
+    bool empty() const
+    {
+        for (const auto& queue : _queues)
+        {
+            if (!queue.empty())
+                return false;
+        }
+        return true;
+    }
+
+    /// takes the oldest message of the most urgent class, the queue must not be empty
+    message_ptr pop(fc::time_point now = fc::time_point::now())
+    {
+        for (size_t pi = 0; pi < message_priorities_count; ++pi)
+        {
+            auto& queue = _queues[pi];
+            if (queue.empty())
+                continue;
+
+            auto& stats = _stats[pi];
+            auto entry = std::move(queue.front());
+            queue.pop_front();
+
+            uint64_t wait_us = std::max<int64_t>((now - entry.enqueue_time).count(), 0);
+
+            --stats.queued_messages;
+            stats.queued_bytes -= entry.size;
+            ++stats.sent_messages;
+            stats.total_wait_us += wait_us;
+            stats.max_wait_us = std::max(stats.max_wait_us, wait_us);
+            _total_bytes -= entry.size;
+
+            return std::move(entry.msg);
+        }
+
+        FC_THROW("send queue is empty");
+    }
+
+    size_t total_bytes() const
+    {
+        return _total_bytes;
+    }
+
+    /// by message_priority name
+    std::map<std::string, send_queue_stats> get_stats() const
+    {
+        std::map<std::string, send_queue_stats> result;
+        for (size_t pi = 0; pi < message_priorities_count; ++pi)
+            result[to_string((message_priority)pi)] = _stats[pi];
+        return result;
+    }
+
+private:
+    push_result enqueue(message_priority priority, message_ptr msg, size_t size, fc::time_point now)
+    {
+        auto& stats = _stats[(size_t)priority];
+
+        _queues[(size_t)priority].push_back({ std::move(msg), size, now });
+
+        ++stats.queued_messages;
+        stats.queued_bytes += size;
+        stats.max_queued_bytes = std::max(stats.max_queued_bytes, stats.queued_bytes);
+        _total_bytes += size;
+
+        return push_result::queued;
+    }
+
+    struct entry
+    {
+        message_ptr msg;
+        size_t size;
+        fc::time_point enqueue_time;
+    };
+
+    std::array<std::deque<entry>, message_priorities_count> _queues;
+    std::array<send_queue_budget, message_priorities_count> _budgets;
+    std::array<send_queue_stats, message_priorities_count> _stats;
+
+    size_t _total_bytes = 0;
+    const size_t _max_total_bytes = GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES;
+};
+}
+}
+
+FC_REFLECT(graphene::net::send_queue_stats,
+           (queued_messages)(queued_bytes)(max_queued_bytes)(sent_messages)(dropped_messages)(total_wait_us)(
+               max_wait_us))
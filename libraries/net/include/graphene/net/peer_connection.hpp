@@ -28,6 +28,7 @@
 #include <graphene/net/message_oriented_connection.hpp>
 #include <graphene/net/stcp_socket.hpp>
 #include <graphene/net/config.hpp>
+#include <graphene/net/message_send_queue.hpp>
 
 #include <boost/tuple/tuple.hpp>
 
@@ -168,8 +169,7 @@ private:
         size_t get_size_in_queue() override;
     };
 
-    size_t _total_queued_messages_size;
-    std::queue<std::unique_ptr<queued_message>, std::list<std::unique_ptr<queued_message>>> _queued_messages;
+    message_send_queue<queued_message> _queued_messages;
     fc::future<void> _send_queued_messages_done;
 
 public:
@@ -211,6 +211,8 @@ public:
     fc::optional<std::string> platform;
     fc::optional<uint32_t> bitness;
     fc::optional<scorum::protocol::chain_id_type> chain_id;
+    /** true if the peer advertised "compact_blocks" in the user_data of its hello message */
+    bool supports_compact_blocks;
 
     // for inbound connections, these fields record what the peer sent us in
     // its hello message.  For outbound, they record what we sent the peer
@@ -274,6 +276,15 @@ public:
 
     item_to_time_map_type items_requested_from_peer; /// items we've requested from this peer during normal operation.
     /// fetch from another peer if this peer disconnects
+
+    /** a compact block received from this peer whose transactions are not all in our message cache */
+    struct partially_reconstructed_block
+    {
+        compact_block_message compact_block;
+        std::vector<fc::optional<signed_transaction>> transactions;
+    };
+    /// compact blocks waiting for compact_block_transactions_message, by the hash of the full block message
+    std::map<item_hash_t, partially_reconstructed_block> blocks_being_reconstructed;
     /// @}
 
     // if they're flooding us with transactions, we set this to avoid fetching for a few seconds to let the
@@ -307,14 +318,23 @@ public:
     void on_message(message_oriented_connection* originating_connection, const message& received_message) override;
     void on_connection_closed(message_oriented_connection* originating_connection) override;
 
-    void send_queueable_message(std::unique_ptr<queued_message>&& message_to_send);
+    void send_queueable_message(std::unique_ptr<queued_message>&& message_to_send,
+                                message_priority priority,
+                                bool solicited = false);
     void send_message(const message& message_to_send, size_t message_send_time_field_offset = (size_t)-1);
+    /// reply to the peer's fetch_items, it bypasses the budget of its class so the peer gets what it waits for
+    void send_fetch_reply(const message& reply);
     void send_item(const item_id& item_to_send);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    uint64_t get_total_bytes_saved_sending() const;
+    uint64_t get_total_bytes_saved_receiving() const;
+    /// queue depths, sent and dropped messages and waiting times per message_priority
+    std::map<std::string, send_queue_stats> get_send_queue_stats() const;
+    void enable_compression(uint32_t threshold);
 
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
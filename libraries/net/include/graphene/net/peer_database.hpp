@@ -101,10 +101,17 @@ public:
     peer_database();
     ~peer_database();
 
-    void open(const fc::path& databaseFilename);
+    /**
+     * Loads the binary database file, changes are appended to it in batches. When the file doesn't exist yet, it is
+     * created from legacyJsonFilename, the whole database saved as JSON by former versions.
+     */
+    void open(const fc::path& databaseFilename, const fc::path& legacyJsonFilename = fc::path());
     void close();
     void clear();
 
+    /// appends the changes which aren't in the file yet
+    void flush();
+
     void erase(const fc::ip::endpoint& endpointToErase);
 
     void update_entry(const potential_peer_record& updatedRecord);
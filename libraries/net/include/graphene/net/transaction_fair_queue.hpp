@@ -0,0 +1,218 @@
+#pragma once
+
+#include <graphene/net/config.hpp>
+
+#include <fc/exception/exception.hpp>
+#include <fc/reflect/reflect.hpp>
+#include <fc/time.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <utility>
+
+namespace graphene {
+namespace net {
+
+struct transaction_rate_limit
+{
+    /// 0 disables the rate limit
+    uint32_t transactions_per_second = GRAPHENE_NET_DEFAULT_PEER_TRANSACTIONS_PER_SECOND;
+    uint32_t burst = GRAPHENE_NET_DEFAULT_PEER_TRANSACTIONS_BURST;
+    uint32_t max_queued = GRAPHENE_NET_DEFAULT_PEER_MAX_QUEUED_TRANSACTIONS;
+};
+
+/// starts full, refills with limit.transactions_per_second up to limit.burst
+class token_bucket
+{
+public:
+    bool consume(const transaction_rate_limit& limit, const fc::time_point& now);
+    /// gives back a consumed token
+    void refund(const transaction_rate_limit& limit);
+    /// when consume will succeed next, assuming no other consumption
+    fc::time_point next_token_time(const transaction_rate_limit& limit) const;
+
+private:
+    double _tokens = -1;
+    fc::time_point _last_refill;
+};
+
+struct peer_transaction_stats
+{
+    /// handed to the delegate, accepted and rejected by it
+    uint64_t accepted = 0;
+    uint64_t rejected = 0;
+
+    /// requests held back over the rate limit, transactions dropped over limit.max_queued
+    uint64_t rate_limited = 0;
+    uint64_t queue_full = 0;
+
+    uint64_t queued = 0;
+};
+
+/**
+ * Inbound transactions of the peers waiting for the delegate.
+ *
+ * A transaction is requested from a peer only if the token bucket of the peer isn't empty, so the bandwidth of
+ * rate-limited transactions isn't spent. A received transaction is let in if the peer has less than limit.max_queued
+ * transactions waiting, otherwise its token is given back. Transactions are taken one per peer in turn, so a peer
+ * flooding us delays transactions of the other peers by at most one own transaction each. A peer has at most one
+ * transaction in flight, it misses its turns until the delegate is done with it, so transactions of a peer reach the
+ * delegate in order.
+ */
+template <typename TPeer, typename TTransaction> class transaction_fair_queue
+{
+public:
+    enum class push_result
+    {
+        queued,
+        queue_full
+    };
+
+    void set_limit(const transaction_rate_limit& limit)
+    {
+        _limit = limit;
+    }
+
+    const transaction_rate_limit& get_limit() const
+    {
+        return _limit;
+    }
+
+    /// takes a token of the peer before requesting a transaction from it
+    bool try_request(const TPeer& peer, const fc::time_point& now = fc::time_point::now())
+    {
+        auto& state = _peers[peer];
+
+        if (!state.bucket.consume(_limit, now))
+        {
+            ++state.stats.rate_limited;
+            return false;
+        }
+        return true;
+    }
+
+    /// when try_request will let a transaction of the peer be requested
+    fc::time_point next_request_time(const TPeer& peer) const
+    {
+        auto it = _peers.find(peer);
+        if (it == _peers.end())
+            return fc::time_point();
+        return it->second.bucket.next_token_time(_limit);
+    }
+
+    /// queues a transaction requested with try_request
+    push_result push(const TPeer& peer, TTransaction trx)
+    {
+        auto& state = _peers[peer];
+
+        if (state.queue.size() >= _limit.max_queued)
+        {
+            state.bucket.refund(_limit);
+            ++state.stats.queue_full;
+            return push_result::queue_full;
+        }
+
+        if (state.queue.empty() && !state.in_flight)
+            _turns.push_back(peer);
+
+        state.queue.push_back(std::move(trx));
+        ++state.stats.queued;
+        ++_size;
+
+        return push_result::queued;
+    }
+
+    bool empty() const
+    {
+        return _size == 0;
+    }
+
+    size_t size() const
+    {
+        return _size;
+    }
+
+    /// peers with waiting transactions and nothing in flight
+    size_t ready_count() const
+    {
+        return _turns.size();
+    }
+
+    /// takes the oldest transaction of the peer whose turn it is, ready_count() must not be zero
+    std::pair<TPeer, TTransaction> pop()
+    {
+        FC_ASSERT(!_turns.empty(), "no transactions ready");
+
+        TPeer peer = _turns.front();
+        _turns.pop_front();
+
+        auto& state = _peers[peer];
+        std::pair<TPeer, TTransaction> result(peer, std::move(state.queue.front()));
+        state.queue.pop_front();
+        state.in_flight = true;
+        --state.stats.queued;
+        --_size;
+
+        return result;
+    }
+
+    /// counts the delegate's verdict on a popped transaction, the peer gets its turns back
+    void complete(const TPeer& peer, bool accepted)
+    {
+        auto it = _peers.find(peer);
+        if (it == _peers.end() || !it->second.in_flight)
+            return;
+
+        auto& state = it->second;
+        if (accepted)
+            ++state.stats.accepted;
+        else
+            ++state.stats.rejected;
+
+        state.in_flight = false;
+        if (!state.queue.empty())
+            _turns.push_back(peer);
+    }
+
+    /// drops the waiting transactions of a disconnected peer
+    void remove_peer(const TPeer& peer)
+    {
+        auto it = _peers.find(peer);
+        if (it == _peers.end())
+            return;
+
+        _size -= it->second.queue.size();
+        _peers.erase(it);
+        _turns.erase(std::remove(_turns.begin(), _turns.end(), peer), _turns.end());
+    }
+
+    peer_transaction_stats get_stats(const TPeer& peer) const
+    {
+        auto it = _peers.find(peer);
+        if (it == _peers.end())
+            return peer_transaction_stats();
+        return it->second.stats;
+    }
+
+private:
+    struct peer_state
+    {
+        token_bucket bucket;
+        std::deque<TTransaction> queue;
+        bool in_flight = false;
+        peer_transaction_stats stats;
+    };
+
+    transaction_rate_limit _limit;
+
+    std::map<TPeer, peer_state> _peers;
+    /// peers with waiting transactions and nothing in flight, the first one is served next
+    std::deque<TPeer> _turns;
+    size_t _size = 0;
+};
+}
+}
+
+FC_REFLECT(graphene::net::transaction_rate_limit, (transactions_per_second)(burst)(max_queued))
+FC_REFLECT(graphene::net::peer_transaction_stats, (accepted)(rejected)(rate_limited)(queue_full)(queued))
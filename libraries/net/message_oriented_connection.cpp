@@ -29,6 +29,7 @@
 #include <fc/io/enum_type.hpp>
 
 #include <graphene/net/message_oriented_connection.hpp>
+#include <graphene/net/core_messages.hpp>
 #include <graphene/net/stcp_socket.hpp>
 #include <graphene/net/config.hpp>
 
@@ -58,6 +59,9 @@ private:
     fc::future<void> _read_loop_done;
     uint64_t _bytes_received;
     uint64_t _bytes_sent;
+    uint64_t _bytes_saved_sending;
+    uint64_t _bytes_saved_receiving;
+    uint32_t _compression_threshold; // 0 while the remote end hasn't told us it can decompress
 
     fc::time_point _connected_time;
     fc::time_point _last_message_received_time;
@@ -71,6 +75,7 @@ private:
 
     void read_loop();
     void start_read_loop();
+    void send_raw_message(const message& message_to_send);
 
 public:
     fc::tcp_socket& get_socket();
@@ -83,11 +88,14 @@ public:
     ~message_oriented_connection_impl();
 
     void send_message(const message& message_to_send);
+    void enable_compression(uint32_t threshold);
     void close_connection();
     void destroy_connection();
 
     uint64_t get_total_bytes_sent() const;
     uint64_t get_total_bytes_received() const;
+    uint64_t get_total_bytes_saved_sending() const;
+    uint64_t get_total_bytes_saved_receiving() const;
 
     fc::time_point get_last_message_sent_time() const;
     fc::time_point get_last_message_received_time() const;
@@ -104,6 +112,9 @@ message_oriented_connection_impl::message_oriented_connection_impl(message_orien
     , _delegate(delegate)
     , _bytes_received(0)
     , _bytes_sent(0)
+    , _bytes_saved_sending(0)
+    , _bytes_saved_receiving(0)
+    , _compression_threshold(0)
     , _send_message_in_progress(false)
 #ifndef NDEBUG
     , _thread(&fc::thread::current())
@@ -181,6 +192,13 @@ void message_oriented_connection_impl::read_loop()
 
             _last_message_received_time = fc::time_point::now();
 
+            if (m.msg_type == compressed_message_type)
+            {
+                message uncompressed = decompress_message(m);
+                _bytes_saved_receiving += uncompressed.size > m.size ? uncompressed.size - m.size : 0;
+                m = std::move(uncompressed);
+            }
+
             try
             {
                 // message handling errors are warnings...
@@ -277,22 +295,39 @@ void message_oriented_connection_impl::send_message(const message& message_to_se
 
     try
     {
-        size_t size_of_message_and_header = sizeof(message_header) + message_to_send.size;
-        if (message_to_send.size > MAX_MESSAGE_SIZE)
-            elog("Trying to send a message larger than MAX_MESSAGE_SIZE. This probably won't work...");
-        // pad the message we send to a multiple of 16 bytes
-        size_t size_with_padding = 16 * ((size_of_message_and_header + 15) / 16);
-        std::unique_ptr<char[]> padded_message(new char[size_with_padding]);
-        memcpy(padded_message.get(), (char*)&message_to_send, sizeof(message_header));
-        memcpy(padded_message.get() + sizeof(message_header), message_to_send.data.data(), message_to_send.size);
-        _sock.write(padded_message.get(), size_with_padding);
-        _sock.flush();
-        _bytes_sent += size_with_padding;
-        _last_message_sent_time = fc::time_point::now();
+        fc::optional<message> compressed;
+        if (_compression_threshold && message_to_send.size >= _compression_threshold)
+            compressed = compress_message(message_to_send);
+        if (compressed)
+            _bytes_saved_sending += message_to_send.size - compressed->size;
+        send_raw_message(compressed ? *compressed : message_to_send);
     }
     FC_RETHROW_EXCEPTIONS(warn, "unable to send message");
 }
 
+void message_oriented_connection_impl::send_raw_message(const message& message_to_send)
+{
+    VERIFY_CORRECT_THREAD();
+    size_t size_of_message_and_header = sizeof(message_header) + message_to_send.size;
+    if (message_to_send.size > MAX_MESSAGE_SIZE)
+        elog("Trying to send a message larger than MAX_MESSAGE_SIZE. This probably won't work...");
+    // pad the message we send to a multiple of 16 bytes
+    size_t size_with_padding = 16 * ((size_of_message_and_header + 15) / 16);
+    std::unique_ptr<char[]> padded_message(new char[size_with_padding]);
+    memcpy(padded_message.get(), (char*)&message_to_send, sizeof(message_header));
+    memcpy(padded_message.get() + sizeof(message_header), message_to_send.data.data(), message_to_send.size);
+    _sock.write(padded_message.get(), size_with_padding);
+    _sock.flush();
+    _bytes_sent += size_with_padding;
+    _last_message_sent_time = fc::time_point::now();
+}
+
+void message_oriented_connection_impl::enable_compression(uint32_t threshold)
+{
+    VERIFY_CORRECT_THREAD();
+    _compression_threshold = threshold;
+}
+
 void message_oriented_connection_impl::close_connection()
 {
     VERIFY_CORRECT_THREAD();
@@ -339,6 +374,18 @@ uint64_t message_oriented_connection_impl::get_total_bytes_received() const
     return _bytes_received;
 }
 
+uint64_t message_oriented_connection_impl::get_total_bytes_saved_sending() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _bytes_saved_sending;
+}
+
+uint64_t message_oriented_connection_impl::get_total_bytes_saved_receiving() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _bytes_saved_receiving;
+}
+
 fc::time_point message_oriented_connection_impl::get_last_message_sent_time() const
 {
     VERIFY_CORRECT_THREAD();
@@ -393,6 +440,11 @@ void message_oriented_connection::send_message(const message& message_to_send)
     my->send_message(message_to_send);
 }
 
+void message_oriented_connection::enable_compression(uint32_t threshold)
+{
+    my->enable_compression(threshold);
+}
+
 void message_oriented_connection::close_connection()
 {
     my->close_connection();
@@ -413,6 +465,16 @@ uint64_t message_oriented_connection::get_total_bytes_received() const
     return my->get_total_bytes_received();
 }
 
+uint64_t message_oriented_connection::get_total_bytes_saved_sending() const
+{
+    return my->get_total_bytes_saved_sending();
+}
+
+uint64_t message_oriented_connection::get_total_bytes_saved_receiving() const
+{
+    return my->get_total_bytes_saved_receiving();
+}
+
 fc::time_point message_oriented_connection::get_last_message_sent_time() const
 {
     return my->get_last_message_sent_time();
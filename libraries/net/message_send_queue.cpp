@@ -0,0 +1,46 @@
+#include <graphene/net/message_send_queue.hpp>
+#include <graphene/net/core_messages.hpp>
+
+namespace graphene {
+namespace net {
+
+message_priority get_message_priority(uint32_t msg_type)
+{
+    switch (msg_type)
+    {
+    case trx_message_type:
+        return message_priority::transaction;
+    case item_ids_inventory_message_type:
+        return message_priority::advertisement;
+    case fetch_items_message_type:
+    case item_not_available_message_type:
+        return message_priority::inventory;
+    case blockchain_item_ids_inventory_message_type:
+    case fetch_blockchain_item_ids_message_type:
+        return message_priority::sync;
+    default:
+        // blocks, compact blocks with their transactions and the small messages of the connection protocol
+        return message_priority::block;
+    }
+}
+
+std::string to_string(message_priority priority)
+{
+    switch (priority)
+    {
+    case message_priority::block:
+        return "block";
+    case message_priority::sync:
+        return "sync";
+    case message_priority::inventory:
+        return "inventory";
+    case message_priority::advertisement:
+        return "advertisement";
+    case message_priority::transaction:
+        return "transaction";
+    default:
+        FC_THROW("Unknown message priority.");
+    }
+}
+}
+}
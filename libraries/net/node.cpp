@@ -25,6 +25,7 @@
 #include <iomanip>
 #include <deque>
 #include <unordered_set>
+#include <unordered_map>
 #include <list>
 #include <forward_list>
 #include <iostream>
@@ -75,6 +76,7 @@
 #include <graphene/net/peer_database.hpp>
 #include <graphene/net/peer_connection.hpp>
 #include <graphene/net/stcp_socket.hpp>
+#include <graphene/net/transaction_fair_queue.hpp>
 #include <graphene/net/config.hpp>
 #include <graphene/net/exceptions.hpp>
 
@@ -179,6 +181,9 @@ public:
     message get_message(const message_hash_type& hash_of_message_to_lookup);
     message_propagation_data
     get_message_propagation_data(const fc::uint160_t& hash_of_message_contents_to_lookup) const;
+    /// hashes of cached transaction messages by their compact block short id
+    std::unordered_map<short_transaction_id_type, message_hash_type>
+    get_transaction_short_ids(const block_id_type& block_id) const;
     size_t size() const
     {
         return _message_cache.size();
@@ -225,6 +230,19 @@ message_propagation_data blockchain_tied_message_cache::get_message_propagation_
     FC_THROW_EXCEPTION(fc::key_not_found_exception, "Requested message not in cache");
 }
 
+std::unordered_map<short_transaction_id_type, message_hash_type>
+blockchain_tied_message_cache::get_transaction_short_ids(const block_id_type& block_id) const
+{
+    std::unordered_map<short_transaction_id_type, message_hash_type> result;
+    for (const message_info& info : _message_cache)
+    {
+        if (info.message_body.msg_type == trx_message_type && info.message_contents_hash != fc::uint160_t())
+            result.emplace(compact_block_message::short_transaction_id(block_id, info.message_contents_hash),
+                           info.message_hash);
+    }
+    return result;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // This specifies configuration info for the local node.  It's stored as JSON
@@ -283,6 +301,44 @@ struct prioritized_item_id
     }
 };
 
+// the /n/ most recent blocks we've accepted, kept in arrival order with a hash index on the side so
+// that checking whether a block was already accepted doesn't need to scan the whole buffer
+class recently_accepted_blocks
+{
+public:
+    explicit recently_accepted_blocks(size_t capacity)
+        : _blocks(capacity)
+    {
+    }
+
+    void push_back(const item_hash_t& block_id)
+    {
+        if (_blocks.full())
+        {
+            auto count_iter = _counts.find(_blocks.front());
+            if (--count_iter->second == 0)
+                _counts.erase(count_iter);
+        }
+        _blocks.push_back(block_id);
+        ++_counts[block_id];
+    }
+
+    bool contains(const item_hash_t& block_id) const
+    {
+        return _counts.find(block_id) != _counts.end();
+    }
+
+    void clear()
+    {
+        _blocks.clear();
+        _counts.clear();
+    }
+
+private:
+    boost::circular_buffer<item_hash_t> _blocks;
+    std::unordered_map<item_hash_t, unsigned> _counts;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 class statistics_gathering_node_delegate_wrapper : public node_delegate
 {
@@ -434,7 +490,8 @@ public:
     fc::sha256 _chain_id;
 
 #define NODE_CONFIGURATION_FILENAME "node_config.json"
-#define POTENTIAL_PEER_DATABASE_FILENAME "peers.json"
+#define POTENTIAL_PEER_DATABASE_FILENAME "peers.dat"
+#define LEGACY_POTENTIAL_PEER_DATABASE_FILENAME "peers.json"
     fc::path _node_configuration_directory;
     node_configuration _node_configuration;
 
@@ -470,11 +527,13 @@ public:
 
     active_sync_requests_map
         _active_sync_requests; /// list of sync blocks we've asked for from peers but have not yet received
-    std::list<graphene::net::block_message>
-        _new_received_sync_items; /// list of sync blocks we've just received but haven't yet tried to process
-    std::list<graphene::net::block_message> _received_sync_items; /// list of sync blocks we've received, but can't yet
+    typedef std::unordered_map<graphene::net::block_id_type, graphene::net::block_message> received_sync_items_map;
+
+    received_sync_items_map _received_sync_items; /// reorder buffer of sync blocks we've received, but can't yet
     /// process because we are still missing blocks that
-    /// come earlier in the chain
+    /// come earlier in the chain. Indexed by block id, so
+    /// the next block can be looked up from the sync peers'
+    /// lists without scanning the buffer
     // @}
 
     fc::future<void> _process_backlog_of_sync_blocks_done;
@@ -506,6 +565,11 @@ public:
     items_to_fetch_set_type _items_to_fetch; /// list of items we know another peer has and we want
     peer_connection::timestamped_items_set_type
         _recently_failed_items; /// list of transactions we've recently pushed and had rejected by the delegate
+
+    /// compact block relay statistics, reported in network_get_usage_stats()
+    uint64_t _compact_blocks_received = 0;
+    uint64_t _compact_blocks_failed = 0;
+    uint64_t _compact_block_transactions_fetched = 0;
     // @}
 
     /// used by the task that advertises inventory during normal operation
@@ -560,7 +624,7 @@ public:
      */
     std::unordered_set<peer_connection_ptr> _terminating_connections;
 
-    boost::circular_buffer<item_hash_t> _most_recent_blocks_accepted; // the /n/ most recent blocks we've accepted
+    recently_accepted_blocks _most_recent_blocks_accepted; // the /n/ most recent blocks we've accepted
     // (currently tuned to the max number of
     // connections)
 
@@ -619,10 +683,24 @@ public:
     unsigned _maximum_number_of_blocks_to_handle_at_one_time;
     unsigned _maximum_number_of_sync_blocks_to_prefetch;
     unsigned _maximum_blocks_per_peer_during_syncing;
+    uint32_t _message_compression_threshold;
 
     std::list<fc::future<void>> _handle_message_calls_in_progress;
     std::set<message_hash_type> _message_ids_currently_being_processed;
 
+    struct received_transaction
+    {
+        message transaction_message;
+        message_hash_type message_hash;
+        fc::time_point receive_time;
+    };
+
+    /// rate limited transactions of the peers waiting for the delegate
+    using received_transaction_queue = transaction_fair_queue<peer_connection_ptr, received_transaction>;
+    received_transaction_queue _received_transactions;
+    unsigned _maximum_number_of_transactions_to_handle_at_one_time;
+    std::list<fc::future<void>> _handle_transaction_calls_in_progress;
+
     node_impl(const std::string& user_agent);
     virtual ~node_impl();
 
@@ -632,6 +710,7 @@ public:
     void trigger_p2p_network_connect_loop();
 
     bool have_already_received_sync_item(const item_hash_t& item_hash);
+    size_t get_sync_window_space(const peer_connection_ptr& peer) const;
     void request_sync_item_from_peer(const peer_connection_ptr& peer, const item_hash_t& item_to_request);
     void request_sync_items_from_peer(const peer_connection_ptr& peer,
                                       const std::vector<item_hash_t>& items_to_request);
@@ -696,6 +775,27 @@ public:
     void on_item_not_available_message(peer_connection* originating_peer,
                                        const item_not_available_message& item_not_available_message_received);
 
+    void on_fetch_compact_blocks(peer_connection* originating_peer,
+                                 const fetch_items_message& fetch_items_message_received);
+
+    void on_compact_block_message(peer_connection* originating_peer,
+                                  const compact_block_message& compact_block_message_received);
+
+    void on_fetch_compact_block_transactions_message(
+        peer_connection* originating_peer,
+        const fetch_compact_block_transactions_message& fetch_compact_block_transactions_message_received);
+
+    void on_compact_block_transactions_message(
+        peer_connection* originating_peer,
+        const compact_block_transactions_message& compact_block_transactions_message_received);
+
+    void finish_compact_block_reconstruction(peer_connection* originating_peer,
+                                             const compact_block_message& compact_block,
+                                             std::vector<signed_transaction>&& transactions);
+
+    fc::optional<graphene::net::block_message> get_block_for_compact_relay(const item_hash_t& item_hash,
+                                                                          const block_id_type& block_id);
+
     void on_item_ids_inventory_message(peer_connection* originating_peer,
                                        const item_ids_inventory_message& item_ids_inventory_message_received);
 
@@ -742,6 +842,16 @@ public:
     void process_ordinary_message(peer_connection* originating_peer,
                                   const message& message_to_process,
                                   const message_hash_type& message_hash);
+    bool deliver_ordinary_message(peer_connection* originating_peer,
+                                  const message& message_to_process,
+                                  const message_hash_type& message_hash,
+                                  const fc::time_point& message_receive_time);
+    void queue_received_transaction(peer_connection* originating_peer,
+                                    const message& transaction_message,
+                                    const message_hash_type& message_hash,
+                                    const fc::time_point& message_receive_time);
+    void trigger_handle_received_transactions();
+    void handle_received_transactions();
 
     void start_synchronizing();
     void start_synchronizing_with_peer(const peer_connection_ptr& peer);
@@ -886,6 +996,8 @@ node_impl::node_impl(const std::string& user_agent)
     , _maximum_number_of_blocks_to_handle_at_one_time(MAXIMUM_NUMBER_OF_BLOCKS_TO_HANDLE_AT_ONE_TIME)
     , _maximum_number_of_sync_blocks_to_prefetch(MAXIMUM_NUMBER_OF_BLOCKS_TO_PREFETCH)
     , _maximum_blocks_per_peer_during_syncing(GRAPHENE_NET_MAX_BLOCKS_PER_PEER_DURING_SYNCING)
+    , _message_compression_threshold(GRAPHENE_NET_MESSAGE_COMPRESSION_THRESHOLD)
+    , _maximum_number_of_transactions_to_handle_at_one_time(GRAPHENE_NET_DEFAULT_TRANSACTIONS_TO_HANDLE_AT_ONE_TIME)
 {
     _rate_limiter.set_actual_rate_time_constant(fc::seconds(2));
     fc::rand_pseudo_bytes(&_node_id.data[0], (int)_node_id.size());
@@ -1057,15 +1169,25 @@ void node_impl::trigger_p2p_network_connect_loop()
 bool node_impl::have_already_received_sync_item(const item_hash_t& item_hash)
 {
     VERIFY_CORRECT_THREAD();
-    return std::find_if(
-               _received_sync_items.begin(), _received_sync_items.end(),
-               [&item_hash](const graphene::net::block_message& message) { return message.block_id == item_hash; })
-        != _received_sync_items.end()
-        || std::find_if(
-               _new_received_sync_items.begin(), _new_received_sync_items.end(),
-               [&item_hash](const graphene::net::block_message& message) { return message.block_id == item_hash; })
-        != _new_received_sync_items.end();
-    ;
+    return _received_sync_items.find(item_hash) != _received_sync_items.end();
+}
+
+// Each syncing peer gets a window of _maximum_blocks_per_peer_during_syncing outstanding block requests.
+// The window is refilled once at least half of it has been delivered, so a peer is kept streaming
+// blocks instead of going idle between batches, while the number of fetch messages stays low.
+size_t node_impl::get_sync_window_space(const peer_connection_ptr& peer) const
+{
+    VERIFY_CORRECT_THREAD();
+    if (!peer->we_need_sync_items_from_peer || peer->inhibit_fetching_sync_blocks)
+        return 0;
+    // don't mix sync requests with outstanding normal-operation or item id requests
+    if (peer->item_ids_requested_from_peer || !peer->items_requested_from_peer.empty())
+        return 0;
+
+    const size_t in_flight = peer->sync_items_requested_from_peer.size();
+    if (in_flight > _maximum_blocks_per_peer_during_syncing / 2)
+        return 0;
+    return _maximum_blocks_per_peer_during_syncing - in_flight;
 }
 
 void node_impl::request_sync_item_from_peer(const peer_connection_ptr& peer, const item_hash_t& item_to_request)
@@ -1113,41 +1235,37 @@ void node_impl::fetch_sync_items_loop()
                 ASSERT_TASK_NOT_PREEMPTED();
                 std::set<item_hash_t> sync_items_to_request;
 
-                // for each idle peer that we're syncing with
+                // for each peer that we're syncing with and that has room in its request window, hand out the
+                // next contiguous stripe of blocks nobody has been asked for yet
                 for (const peer_connection_ptr& peer : _active_connections)
                 {
-                    if (peer->we_need_sync_items_from_peer
-                        && sync_item_requests_to_send.find(peer) == sync_item_requests_to_send.end()
-                        && // if we've already scheduled a request for this peer, don't consider scheduling another
-                        peer->idle())
+                    const size_t window_space = get_sync_window_space(peer);
+                    if (window_space == 0)
+                        continue;
+
+                    std::vector<item_hash_t>& stripe = sync_item_requests_to_send[peer];
+                    // loop through the items it has that we don't yet have on our blockchain
+                    for (const item_hash_t& item_to_potentially_request : peer->ids_of_items_to_get)
                     {
-                        if (!peer->inhibit_fetching_sync_blocks)
+                        // if we don't already have this item in our temporary storage and we haven't requested
+                        // from another syncing peer
+                        if (!have_already_received_sync_item(item_to_potentially_request)
+                            && // already got it, but for some reson it's still in our list of items to fetch
+                            sync_items_to_request.find(item_to_potentially_request) == sync_items_to_request.end()
+                            && // we have already decided to request it from another peer during this iteration
+                            _active_sync_requests.find(item_to_potentially_request)
+                                == _active_sync_requests.end()) // we've requested it in a previous iteration
+                        // and we're still waiting for it to arrive
                         {
-                            // loop through the items it has that we don't yet have on our blockchain
-                            for (unsigned i = 0; i < peer->ids_of_items_to_get.size(); ++i)
-                            {
-                                item_hash_t item_to_potentially_request = peer->ids_of_items_to_get[i];
-                                // if we don't already have this item in our temporary storage and we haven't requested
-                                // from another syncing peer
-                                if (!have_already_received_sync_item(item_to_potentially_request)
-                                    && // already got it, but for some reson it's still in our list of items to fetch
-                                    sync_items_to_request.find(item_to_potentially_request)
-                                        == sync_items_to_request.end()
-                                    && // we have already decided to request it from another peer during this iteration
-                                    _active_sync_requests.find(item_to_potentially_request)
-                                        == _active_sync_requests.end()) // we've requested it in a previous iteration
-                                // and we're still waiting for it to arrive
-                                {
-                                    // then schedule a request from this peer
-                                    sync_item_requests_to_send[peer].push_back(item_to_potentially_request);
-                                    sync_items_to_request.insert(item_to_potentially_request);
-                                    if (sync_item_requests_to_send[peer].size()
-                                        >= _maximum_blocks_per_peer_during_syncing)
-                                        break;
-                                }
-                            }
+                            // then schedule a request from this peer
+                            stripe.push_back(item_to_potentially_request);
+                            sync_items_to_request.insert(item_to_potentially_request);
+                            if (stripe.size() >= window_space)
+                                break;
                         }
                     }
+                    if (stripe.empty())
+                        sync_item_requests_to_send.erase(peer);
                 }
             } // end non-preemptable section
 
@@ -1278,6 +1396,11 @@ void node_impl::fetch_items_loop()
                             && peer->is_transaction_fetching_inhibited())
                             next_peer_unblocked_time
                                 = std::min(peer->transaction_fetching_inhibited_until, next_peer_unblocked_time);
+                        // a peer over its transaction rate isn't asked, another peer that has it may be
+                        else if (item_iter->item.item_type == graphene::net::trx_message_type
+                                 && !_received_transactions.try_request(peer))
+                            next_peer_unblocked_time
+                                = std::min(_received_transactions.next_request_time(peer), next_peer_unblocked_time);
                         else
                         {
                             // dlog("requesting item ${hash} from peer ${endpoint}",
@@ -1321,7 +1444,14 @@ void node_impl::fetch_items_loop()
                                 ("endpoint", peer_and_items.peer->get_remote_endpoint())("id", id));
                     }
 
-                peer_and_items.peer->send_message(fetch_items_message(items_by_type.first, items_by_type.second));
+                // peers which support it send us a header and short transaction ids instead of the full block,
+                // we already have most of the transactions in our message cache
+                uint32_t requested_item_type = items_by_type.first;
+                if (requested_item_type == core_message_type_enum::block_message_type
+                    && peer_and_items.peer->supports_compact_blocks)
+                    requested_item_type = core_message_type_enum::compact_block_message_type;
+
+                peer_and_items.peer->send_message(fetch_items_message(requested_item_type, items_by_type.second));
             }
         }
         items_by_peer.clear();
@@ -1758,6 +1888,8 @@ void node_impl::dump_node_status_task()
 {
     VERIFY_CORRECT_THREAD();
     dump_node_status();
+    // changes of the peer database are appended in batches, don't keep the last ones in memory for long
+    _potential_peer_db.flush();
     if (!_node_is_shutting_down && !_dump_node_status_task_done.canceled())
         _dump_node_status_task_done = fc::schedule([=]() { dump_node_status_task(); },
                                                    fc::time_point::now() + fc::minutes(1), "dump_node_status_task");
@@ -1973,6 +2105,17 @@ void node_impl::on_message(peer_connection* originating_peer, const message& rec
     case core_message_type_enum::block_message_type:
         process_block_message(originating_peer, received_message, message_hash);
         break;
+    case core_message_type_enum::compact_block_message_type:
+        on_compact_block_message(originating_peer, received_message.as<compact_block_message>());
+        break;
+    case core_message_type_enum::fetch_compact_block_transactions_message_type:
+        on_fetch_compact_block_transactions_message(originating_peer,
+                                                    received_message.as<fetch_compact_block_transactions_message>());
+        break;
+    case core_message_type_enum::compact_block_transactions_message_type:
+        on_compact_block_transactions_message(originating_peer,
+                                              received_message.as<compact_block_transactions_message>());
+        break;
     case core_message_type_enum::current_time_request_message_type:
         on_current_time_request_message(originating_peer, received_message.as<current_time_request_message>());
         break;
@@ -2036,6 +2179,9 @@ fc::variant_object node_impl::generate_hello_user_data()
         user_data["last_known_fork_block_number"] = _hard_fork_block_numbers.back();
 
     user_data["chain_id"] = _chain_id;
+    user_data["compact_blocks"] = true;
+    if (_message_compression_threshold)
+        user_data["compression"] = "zlib";
 
     return user_data;
 }
@@ -2064,6 +2210,12 @@ void node_impl::parse_hello_user_data_for_peer(peer_connection* originating_peer
         originating_peer->last_known_fork_block_number = user_data["last_known_fork_block_number"].as<uint32_t>();
     if (user_data.contains("chain_id"))
         originating_peer->chain_id = user_data["chain_id"].as<scorum::protocol::chain_id_type>();
+    if (user_data.contains("compact_blocks"))
+        originating_peer->supports_compact_blocks = user_data["compact_blocks"].as_bool();
+    // the peer told us it can unwrap compressed_message, so large messages may be sent compressed from now on
+    if (_message_compression_threshold && user_data.contains("compression")
+        && user_data["compression"].as_string() == "zlib")
+        originating_peer->enable_compression(_message_compression_threshold);
 }
 
 void node_impl::on_hello_message(peer_connection* originating_peer, const hello_message& hello_message_received)
@@ -2983,6 +3135,12 @@ void node_impl::on_fetch_items_message(peer_connection* originating_peer,
          ("ids", fetch_items_message_received.items_to_fetch)("type", fetch_items_message_received.item_type)(
              "endpoint", originating_peer->get_remote_endpoint()));
 
+    if (fetch_items_message_received.item_type == compact_block_message_type)
+    {
+        on_fetch_compact_blocks(originating_peer, fetch_items_message_received);
+        return;
+    }
+
     fc::optional<message> last_block_message_sent;
 
     std::list<message> reply_messages;
@@ -3037,8 +3195,241 @@ void node_impl::on_fetch_items_message(peer_connection* originating_peer,
         if (reply.msg_type == block_message_type)
             originating_peer->send_item(item_id(block_message_type, reply.as<graphene::net::block_message>().block_id));
         else
-            originating_peer->send_message(reply);
+            originating_peer->send_fetch_reply(reply);
+    }
+}
+
+fc::optional<graphene::net::block_message> node_impl::get_block_for_compact_relay(const item_hash_t& item_hash,
+                                                                                 const block_id_type& block_id)
+{
+    VERIFY_CORRECT_THREAD();
+    fc::optional<graphene::net::block_message> result;
+
+    // during normal operation blocks are requested by the hash of the block message, so it's usually in our cache
+    try
+    {
+        result = _message_cache.get_message(item_hash).as<graphene::net::block_message>();
+        return result;
+    }
+    catch (fc::key_not_found_exception&)
+    {
+    }
+
+    if (block_id == block_id_type())
+        return result;
+
+    try
+    {
+        result = _delegate->get_item(item_id(block_message_type, block_id)).as<graphene::net::block_message>();
+    }
+    catch (fc::key_not_found_exception&)
+    {
+    }
+    return result;
+}
+
+void node_impl::on_fetch_compact_blocks(peer_connection* originating_peer,
+                                        const fetch_items_message& fetch_items_message_received)
+{
+    VERIFY_CORRECT_THREAD();
+    for (const item_hash_t& item_hash : fetch_items_message_received.items_to_fetch)
+    {
+        fc::optional<graphene::net::block_message> block = get_block_for_compact_relay(item_hash, block_id_type());
+        if (!block)
+        {
+            dlog("received compact block request from peer ${endpoint} but we don't have it",
+                 ("endpoint", originating_peer->get_remote_endpoint()));
+            originating_peer->send_message(item_not_available_message(item_id(block_message_type, item_hash)));
+            continue;
+        }
+
+        originating_peer->last_block_delegate_has_seen = block->block_id;
+        originating_peer->last_block_time_delegate_has_seen = block->block.timestamp;
+
+        originating_peer->send_message(compact_block_message(item_hash, block->block));
+    }
+}
+
+void node_impl::on_compact_block_message(peer_connection* originating_peer,
+                                         const compact_block_message& compact_block_message_received)
+{
+    VERIFY_CORRECT_THREAD();
+    const item_hash_t& item_hash = compact_block_message_received.item_hash;
+
+    if (originating_peer->items_requested_from_peer.find(item_id(block_message_type, item_hash))
+        == originating_peer->items_requested_from_peer.end())
+    {
+        wlog("received a compact block I didn't ask for from peer ${endpoint}, disconnecting from peer",
+             ("endpoint", originating_peer->get_remote_endpoint()));
+        fc::exception detailed_error(
+            FC_LOG_MESSAGE(error, "You sent me a compact block that I didn't ask for, message_hash: ${message_hash}",
+                           ("message_hash", item_hash)));
+        disconnect_from_peer(originating_peer, "You sent me a block that I didn't ask for", true, detailed_error);
+        return;
+    }
+
+    const block_id_type block_id = compact_block_message_received.header.id();
+    const auto& short_ids = compact_block_message_received.short_transaction_ids;
+
+    std::unordered_map<short_transaction_id_type, message_hash_type> cached_transactions;
+    if (!short_ids.empty())
+        cached_transactions = _message_cache.get_transaction_short_ids(block_id);
+
+    peer_connection::partially_reconstructed_block partial_block;
+    partial_block.transactions.resize(short_ids.size());
+
+    std::vector<uint32_t> missing_indexes;
+    for (uint32_t i = 0; i < short_ids.size(); ++i)
+    {
+        auto itr = cached_transactions.find(short_ids[i]);
+        if (itr != cached_transactions.end())
+        {
+            try
+            {
+                partial_block.transactions[i] = _message_cache.get_message(itr->second).as<trx_message>().trx;
+                continue;
+            }
+            catch (fc::key_not_found_exception&)
+            {
+            }
+        }
+        missing_indexes.push_back(i);
+    }
+
+    ++_compact_blocks_received;
+
+    if (missing_indexes.empty())
+    {
+        std::vector<signed_transaction> transactions;
+        transactions.reserve(partial_block.transactions.size());
+        for (auto& trx : partial_block.transactions)
+            transactions.push_back(std::move(*trx));
+
+        finish_compact_block_reconstruction(originating_peer, compact_block_message_received, std::move(transactions));
+        return;
+    }
+
+    dlog("compact block ${id} from peer ${endpoint} misses ${n} of ${total} transactions, fetching them",
+         ("id", block_id)("endpoint", originating_peer->get_remote_endpoint())("n", missing_indexes.size())(
+             "total", short_ids.size()));
+
+    _compact_block_transactions_fetched += missing_indexes.size();
+
+    partial_block.compact_block = compact_block_message_received;
+    originating_peer->blocks_being_reconstructed[item_hash] = std::move(partial_block);
+    originating_peer->send_message(fetch_compact_block_transactions_message(item_hash, block_id, missing_indexes));
+}
+
+void node_impl::on_fetch_compact_block_transactions_message(
+    peer_connection* originating_peer,
+    const fetch_compact_block_transactions_message& fetch_compact_block_transactions_message_received)
+{
+    VERIFY_CORRECT_THREAD();
+    const auto& request = fetch_compact_block_transactions_message_received;
+
+    fc::optional<graphene::net::block_message> block = get_block_for_compact_relay(request.item_hash, request.block_id);
+    if (!block)
+    {
+        originating_peer->send_message(item_not_available_message(item_id(block_message_type, request.item_hash)));
+        return;
+    }
+
+    compact_block_transactions_message reply;
+    reply.item_hash = request.item_hash;
+    reply.transactions.reserve(request.indexes.size());
+    for (uint32_t index : request.indexes)
+    {
+        if (index >= block->block.transactions.size())
+        {
+            originating_peer->send_message(
+                item_not_available_message(item_id(block_message_type, request.item_hash)));
+            return;
+        }
+        reply.transactions.push_back(block->block.transactions[index]);
+    }
+
+    originating_peer->send_message(reply);
+}
+
+void node_impl::on_compact_block_transactions_message(
+    peer_connection* originating_peer,
+    const compact_block_transactions_message& compact_block_transactions_message_received)
+{
+    VERIFY_CORRECT_THREAD();
+    const item_hash_t& item_hash = compact_block_transactions_message_received.item_hash;
+
+    auto itr = originating_peer->blocks_being_reconstructed.find(item_hash);
+    if (itr == originating_peer->blocks_being_reconstructed.end())
+    {
+        wlog("received compact block transactions I didn't ask for from peer ${endpoint}, disconnecting from peer",
+             ("endpoint", originating_peer->get_remote_endpoint()));
+        fc::exception detailed_error(FC_LOG_MESSAGE(
+            error, "You sent me compact block transactions that I didn't ask for, message_hash: ${message_hash}",
+            ("message_hash", item_hash)));
+        disconnect_from_peer(originating_peer, "You sent me a message that I didn't request", true, detailed_error);
+        return;
+    }
+
+    peer_connection::partially_reconstructed_block partial_block = std::move(itr->second);
+    originating_peer->blocks_being_reconstructed.erase(itr);
+
+    auto received_itr = compact_block_transactions_message_received.transactions.begin();
+    const auto received_end = compact_block_transactions_message_received.transactions.end();
+
+    std::vector<signed_transaction> transactions;
+    transactions.reserve(partial_block.transactions.size());
+    for (auto& trx : partial_block.transactions)
+    {
+        if (trx.valid())
+            transactions.push_back(std::move(*trx));
+        else if (received_itr != received_end)
+            transactions.push_back(*received_itr++);
+        else
+            break;
     }
+
+    if (transactions.size() != partial_block.transactions.size() || received_itr != received_end)
+    {
+        wlog("peer ${endpoint} sent a wrong number of compact block transactions, fetching the full block",
+             ("endpoint", originating_peer->get_remote_endpoint()));
+        originating_peer->send_message(fetch_items_message(block_message_type, { item_hash }));
+        return;
+    }
+
+    finish_compact_block_reconstruction(originating_peer, partial_block.compact_block, std::move(transactions));
+}
+
+void node_impl::finish_compact_block_reconstruction(peer_connection* originating_peer,
+                                                    const compact_block_message& compact_block,
+                                                    std::vector<signed_transaction>&& transactions)
+{
+    VERIFY_CORRECT_THREAD();
+    signed_block block;
+    static_cast<scorum::protocol::signed_block_header&>(block) = compact_block.header;
+    block.transactions = std::move(transactions);
+
+    // a short id collision in our cache gives a block that doesn't match its header,
+    // fall back to fetching the full block from the same peer
+    if (block.calculate_merkle_root() != block.transaction_merkle_root)
+    {
+        wlog("compact block ${hash} from peer ${endpoint} didn't reconstruct, fetching the full block",
+             ("hash", compact_block.item_hash)("endpoint", originating_peer->get_remote_endpoint()));
+        ++_compact_blocks_failed;
+        originating_peer->send_message(fetch_items_message(block_message_type, { compact_block.item_hash }));
+        return;
+    }
+
+    message block_message_to_process(graphene::net::block_message{ block });
+    if (block_message_to_process.id() != compact_block.item_hash)
+    {
+        wlog("compact block from peer ${endpoint} doesn't match requested ${hash}, fetching the full block",
+             ("hash", compact_block.item_hash)("endpoint", originating_peer->get_remote_endpoint()));
+        ++_compact_blocks_failed;
+        originating_peer->send_message(fetch_items_message(block_message_type, { compact_block.item_hash }));
+        return;
+    }
+
+    process_block_message(originating_peer, block_message_to_process, compact_block.item_hash);
 }
 
 void node_impl::on_item_not_available_message(peer_connection* originating_peer,
@@ -3050,6 +3441,7 @@ void node_impl::on_item_not_available_message(peer_connection* originating_peer,
     if (regular_item_iter != originating_peer->items_requested_from_peer.end())
     {
         originating_peer->items_requested_from_peer.erase(regular_item_iter);
+        originating_peer->blocks_being_reconstructed.erase(requested_item.item_hash);
         originating_peer->inventory_peer_advertised_to_us.erase(requested_item);
         if (is_item_in_any_peers_inventory(requested_item))
             _items_to_fetch.insert(prioritized_item_id(requested_item, _items_to_fetch_sequence_counter++));
@@ -3200,6 +3592,7 @@ void node_impl::on_connection_closed(peer_connection* originating_peer)
     VERIFY_CORRECT_THREAD();
     peer_connection_ptr originating_peer_ptr = originating_peer->shared_from_this();
     _rate_limiter.remove_tcp_socket(&originating_peer->get_socket());
+    _received_transactions.remove_peer(originating_peer_ptr);
 
     // if we closed the connection (due to timeout or handshake failure), we should have recorded an
     // error message to store in the peer database when we closed the connection
@@ -3522,86 +3915,85 @@ void node_impl::process_backlog_of_sync_blocks()
 
     do
     {
-        std::copy(std::make_move_iterator(_new_received_sync_items.begin()),
-                  std::make_move_iterator(_new_received_sync_items.end()), std::front_inserter(_received_sync_items));
-        _new_received_sync_items.clear();
         dlog("currently ${count} sync items to consider", ("count", _received_sync_items.size()));
 
         block_processed_this_iteration = false;
-        for (auto received_block_iter = _received_sync_items.begin(); received_block_iter != _received_sync_items.end();
-             ++received_block_iter)
+
+        // the next block on the active chain or one of the forks is always at the front of some syncing peer's
+        // list, so look those up in the reorder buffer instead of matching every buffered block against every peer
+        auto received_block_iter = _received_sync_items.end();
+        for (const peer_connection_ptr& peer : _active_connections)
         {
+            ASSERT_TASK_NOT_PREEMPTED(); // don't yield while iterating over _active_connections
+            if (!peer->ids_of_items_to_get.empty())
+            {
+                received_block_iter = _received_sync_items.find(peer->ids_of_items_to_get.front());
+                if (received_block_iter != _received_sync_items.end())
+                    break;
+            }
+        }
 
-            // find out if this block is the next block on the active chain or one of the forks
-            bool potential_first_block = false;
+        if (received_block_iter != _received_sync_items.end())
+        {
+            // process it, remove it from all sync peers lists
             for (const peer_connection_ptr& peer : _active_connections)
             {
                 ASSERT_TASK_NOT_PREEMPTED(); // don't yield while iterating over _active_connections
                 if (!peer->ids_of_items_to_get.empty()
-                    && peer->ids_of_items_to_get.front() == received_block_iter->block_id)
+                    && peer->ids_of_items_to_get.front() == received_block_iter->first)
                 {
-                    potential_first_block = true;
                     peer->ids_of_items_to_get.pop_front();
-                    peer->ids_of_items_being_processed.insert(received_block_iter->block_id);
+                    peer->ids_of_items_being_processed.insert(received_block_iter->first);
                 }
             }
 
-            // if it is, process it, remove it from all sync peers lists
-            if (potential_first_block)
+            graphene::net::block_message block_message_to_process = std::move(received_block_iter->second);
+            _received_sync_items.erase(received_block_iter);
+            block_processed_this_iteration = true;
+
+            // we can get into an interesting situation near the end of synchronization.  We can be in
+            // sync with one peer who is sending us the last block on the chain via a regular inventory
+            // message, while at the same time still be synchronizing with a peer who is sending us the
+            // block through the sync mechanism.  Further, we must request both blocks because
+            // we don't know they're the same (for the peer in normal operation, it has only told us the
+            // message id, for the peer in the sync case we only known the block_id).
+            if (!_most_recent_blocks_accepted.contains(block_message_to_process.block_id))
             {
-                // we can get into an interesting situation near the end of synchronization.  We can be in
-                // sync with one peer who is sending us the last block on the chain via a regular inventory
-                // message, while at the same time still be synchronizing with a peer who is sending us the
-                // block through the sync mechanism.  Further, we must request both blocks because
-                // we don't know they're the same (for the peer in normal operation, it has only told us the
-                // message id, for the peer in the sync case we only known the block_id).
-                if (std::find(_most_recent_blocks_accepted.begin(), _most_recent_blocks_accepted.end(),
-                              received_block_iter->block_id)
-                    == _most_recent_blocks_accepted.end())
-                {
-                    graphene::net::block_message block_message_to_process = *received_block_iter;
-                    _received_sync_items.erase(received_block_iter);
-                    _handle_message_calls_in_progress.emplace_back(fc::async(
-                        [this, block_message_to_process]() {
-                            send_sync_block_to_node_delegate(block_message_to_process);
-                        },
-                        "send_sync_block_to_node_delegate"));
-                    ++blocks_processed;
-                    block_processed_this_iteration = true;
-                }
-                else
+                _handle_message_calls_in_progress.emplace_back(fc::async(
+                    [this, block_message_to_process]() { send_sync_block_to_node_delegate(block_message_to_process); },
+                    "send_sync_block_to_node_delegate"));
+                ++blocks_processed;
+            }
+            else
+            {
+                dlog("Already received and accepted this block (presumably through normal inventory mechanism), "
+                     "treating it as accepted");
+                for (const peer_connection_ptr& peer : _active_connections)
                 {
-                    dlog("Already received and accepted this block (presumably through normal inventory mechanism), "
-                         "treating it as accepted");
-                    for (const peer_connection_ptr& peer : _active_connections)
+                    auto items_being_processed_iter
+                        = peer->ids_of_items_being_processed.find(block_message_to_process.block_id);
+                    if (items_being_processed_iter != peer->ids_of_items_being_processed.end())
                     {
-                        auto items_being_processed_iter
-                            = peer->ids_of_items_being_processed.find(received_block_iter->block_id);
-                        if (items_being_processed_iter != peer->ids_of_items_being_processed.end())
+                        peer->ids_of_items_being_processed.erase(items_being_processed_iter);
+                        dlog("Removed item from ${endpoint}'s list of items being processed, still processing "
+                             "${len} blocks",
+                             ("endpoint", peer->get_remote_endpoint())("len",
+                                                                       peer->ids_of_items_being_processed.size()));
+
+                        // if we just processed the last item in our list from this peer, we will want to
+                        // send another request to find out if we are now in sync (this is normally handled in
+                        // send_sync_block_to_node_delegate)
+                        if (peer->ids_of_items_to_get.empty() && peer->number_of_unfetched_item_ids == 0
+                            && peer->ids_of_items_being_processed.empty())
                         {
-                            peer->ids_of_items_being_processed.erase(items_being_processed_iter);
-                            dlog("Removed item from ${endpoint}'s list of items being processed, still processing "
-                                 "${len} blocks",
-                                 ("endpoint", peer->get_remote_endpoint())("len",
-                                                                           peer->ids_of_items_being_processed.size()));
-
-                            // if we just processed the last item in our list from this peer, we will want to
-                            // send another request to find out if we are now in sync (this is normally handled in
-                            // send_sync_block_to_node_delegate)
-                            if (peer->ids_of_items_to_get.empty() && peer->number_of_unfetched_item_ids == 0
-                                && peer->ids_of_items_being_processed.empty())
-                            {
-                                dlog("We received last item in our list for peer ${endpoint}, setup to do a sync check",
-                                     ("endpoint", peer->get_remote_endpoint()));
-                                fetch_next_batch_of_item_ids_from_peer(peer.get());
-                            }
+                            dlog("We received last item in our list for peer ${endpoint}, setup to do a sync check",
+                                 ("endpoint", peer->get_remote_endpoint()));
+                            fetch_next_batch_of_item_ids_from_peer(peer.get());
                         }
                     }
                 }
-
-                break; // start iterating _received_sync_items from the beginning
-            } // end if potential_first_block
-        } // end for each block in _received_sync_items
+            }
+        } // end if the next block is in the reorder buffer
 
         if (_handle_message_calls_in_progress.size() >= _maximum_number_of_blocks_to_handle_at_one_time)
         {
@@ -3637,9 +4029,9 @@ void node_impl::process_block_during_sync(peer_connection* originating_peer,
     VERIFY_CORRECT_THREAD();
     dlog("received a sync block from peer ${endpoint}", ("endpoint", originating_peer->get_remote_endpoint()));
 
-    // add it to the front of _received_sync_items, then process _received_sync_items to try to
+    // add it to the reorder buffer, then process _received_sync_items to try to
     // pass as many messages as possible to the client.
-    _new_received_sync_items.push_front(block_message_to_process);
+    _received_sync_items.emplace(block_message_to_process.block_id, block_message_to_process);
     trigger_process_backlog_of_sync_blocks();
 }
 
@@ -3664,9 +4056,7 @@ void node_impl::process_block_during_normal_operation(peer_connection* originati
         // we don't know they're the same (for the peer in normal operation, it has only told us the
         // message id, for the peer in the sync case we only known the block_id).
         fc::time_point message_validated_time;
-        if (std::find(_most_recent_blocks_accepted.begin(), _most_recent_blocks_accepted.end(),
-                      block_message_to_process.block_id)
-            == _most_recent_blocks_accepted.end())
+        if (!_most_recent_blocks_accepted.contains(block_message_to_process.block_id))
         {
             std::vector<fc::uint160_t> contained_transaction_message_ids;
             _message_ids_currently_being_processed.insert(message_hash);
@@ -4196,39 +4586,120 @@ void node_impl::process_ordinary_message(peer_connection* originating_peer,
         if (originating_peer->idle())
             trigger_fetch_items_loop();
 
-        // Next: have the delegate process the message
-        fc::time_point message_validated_time;
-        try
+        if (message_to_process.msg_type == trx_message_type)
+            queue_received_transaction(originating_peer, message_to_process, message_hash, message_receive_time);
+        else
+            deliver_ordinary_message(originating_peer, message_to_process, message_hash, message_receive_time);
+    }
+}
+
+bool node_impl::deliver_ordinary_message(peer_connection* originating_peer,
+                                         const message& message_to_process,
+                                         const message_hash_type& message_hash,
+                                         const fc::time_point& message_receive_time)
+{
+    VERIFY_CORRECT_THREAD();
+
+    // Next: have the delegate process the message
+    fc::time_point message_validated_time;
+    try
+    {
+        if (message_to_process.msg_type == trx_message_type)
         {
-            if (message_to_process.msg_type == trx_message_type)
-            {
-                trx_message transaction_message_to_process = message_to_process.as<trx_message>();
-                dlog("passing message containing transaction ${trx} to client",
-                     ("trx", transaction_message_to_process.trx.id()));
-                _delegate->handle_transaction(transaction_message_to_process);
-            }
-            else
-                _delegate->handle_message(message_to_process);
-            message_validated_time = fc::time_point::now();
+            trx_message transaction_message_to_process = message_to_process.as<trx_message>();
+            dlog("passing message containing transaction ${trx} to client",
+                 ("trx", transaction_message_to_process.trx.id()));
+            _delegate->handle_transaction(transaction_message_to_process);
         }
-        catch (const fc::canceled_exception&)
+        else
+            _delegate->handle_message(message_to_process);
+        message_validated_time = fc::time_point::now();
+    }
+    catch (const fc::canceled_exception&)
+    {
+        throw;
+    }
+    catch (const fc::exception& e)
+    {
+        wlog("client rejected message sent by peer ${peer}, ${e}",
+             ("peer", originating_peer->get_remote_endpoint())("e", e));
+        // record it so we don't try to fetch this item again
+        _recently_failed_items.insert(peer_connection::timestamped_item_id(
+            item_id(message_to_process.msg_type, message_hash), fc::time_point::now()));
+        return false;
+    }
+
+    // finally, if the delegate validated the message, broadcast it to our other peers
+    message_propagation_data propagation_data{ message_receive_time, message_validated_time,
+                                               originating_peer->node_id };
+    broadcast(message_to_process, propagation_data);
+    return true;
+}
+
+void node_impl::queue_received_transaction(peer_connection* originating_peer,
+                                           const message& transaction_message,
+                                           const message_hash_type& message_hash,
+                                           const fc::time_point& message_receive_time)
+{
+    VERIFY_CORRECT_THREAD();
+
+    // the rate limit was applied when the transaction was requested
+    auto result = _received_transactions.push(
+        originating_peer->shared_from_this(),
+        received_transaction{ transaction_message, message_hash, message_receive_time });
+
+    // other peers may still send the dropped transaction, so it isn't recorded as failed
+    if (result == received_transaction_queue::push_result::queue_full)
+    {
+        dlog("peer ${peer} has too many transactions waiting, dropping transaction",
+             ("peer", originating_peer->get_remote_endpoint()));
+        return;
+    }
+
+    trigger_handle_received_transactions();
+}
+
+void node_impl::trigger_handle_received_transactions()
+{
+    VERIFY_CORRECT_THREAD();
+
+    _handle_transaction_calls_in_progress.remove_if([](const fc::future<void>& call) { return call.ready(); });
+    if (_node_is_shutting_down)
+        return;
+
+    // each task takes transactions until none is ready, the delegate yields while checking one of them
+    while (_handle_transaction_calls_in_progress.size() < std::min<size_t>(
+               _maximum_number_of_transactions_to_handle_at_one_time, _received_transactions.ready_count()))
+    {
+        _handle_transaction_calls_in_progress.emplace_back(
+            fc::async([this]() { handle_received_transactions(); }, "handle_received_transactions"));
+    }
+}
+
+void node_impl::handle_received_transactions()
+{
+    VERIFY_CORRECT_THREAD();
+
+    // a peer's next transaction is ready only after its previous one is completed, so tasks never hand two
+    // transactions of the same peer to the delegate at once
+    while (_received_transactions.ready_count() > 0)
+    {
+        auto next = _received_transactions.pop();
+        const peer_connection_ptr& originating_peer = next.first;
+        const received_transaction& transaction = next.second;
+
+        bool accepted = false;
+        try
         {
-            throw;
+            accepted = deliver_ordinary_message(originating_peer.get(), transaction.transaction_message,
+                                                transaction.message_hash, transaction.receive_time);
         }
-        catch (const fc::exception& e)
+        catch (...)
         {
-            wlog("client rejected message sent by peer ${peer}, ${e}",
-                 ("peer", originating_peer->get_remote_endpoint())("e", e));
-            // record it so we don't try to fetch this item again
-            _recently_failed_items.insert(peer_connection::timestamped_item_id(
-                item_id(message_to_process.msg_type, message_hash), fc::time_point::now()));
-            return;
+            _received_transactions.complete(originating_peer, false);
+            throw;
         }
-
-        // finally, if the delegate validated the message, broadcast it to our other peers
-        message_propagation_data propagation_data{ message_receive_time, message_validated_time,
-                                                   originating_peer->node_id };
-        broadcast(message_to_process, propagation_data);
+        _received_transactions.complete(originating_peer, accepted);
     }
 }
 
@@ -4348,6 +4819,28 @@ void node_impl::close()
         wlog("Exception thrown while terminating Process backlog of sync items task, ignoring");
     }
 
+    for (fc::future<void>& call : _handle_transaction_calls_in_progress)
+    {
+        try
+        {
+            if (!call.ready())
+                call.cancel_and_wait("node_impl::close()");
+        }
+        catch (const fc::canceled_exception&)
+        {
+        }
+        catch (const fc::exception& e)
+        {
+            wlog("Exception thrown while terminating handle_received_transactions task, ignoring: ${e}", ("e", e));
+        }
+        catch (...)
+        {
+            wlog("Exception thrown while terminating handle_received_transactions task, ignoring");
+        }
+    }
+    _handle_transaction_calls_in_progress.clear();
+    dlog("handle_received_transactions tasks terminated");
+
     unsigned handle_message_call_count = 0;
     while (true)
     {
@@ -4808,7 +5301,8 @@ void node_impl::load_configuration(const fc::path& configuration_directory)
     fc::path potential_peer_database_file_name(_node_configuration_directory / POTENTIAL_PEER_DATABASE_FILENAME);
     try
     {
-        _potential_peer_db.open(potential_peer_database_file_name);
+        _potential_peer_db.open(potential_peer_database_file_name,
+                                _node_configuration_directory / LEGACY_POTENTIAL_PEER_DATABASE_FILENAME);
 
         // push back the time on all peers loaded from the database so we will be able to retry them immediately
         for (peer_database::iterator itr = _potential_peer_db.begin(); itr != _potential_peer_db.end(); ++itr)
@@ -5091,7 +5585,6 @@ void node_impl::dump_node_status()
     ilog("--------- MEMORY USAGE ------------");
     ilog("node._active_sync_requests size: ${size}", ("size", _active_sync_requests.size()));
     ilog("node._received_sync_items size: ${size}", ("size", _received_sync_items.size()));
-    ilog("node._new_received_sync_items size: ${size}", ("size", _new_received_sync_items.size()));
     ilog("node._items_to_fetch size: ${size}", ("size", _items_to_fetch.size()));
     ilog("node._new_inventory size: ${size}", ("size", _new_inventory.size()));
     ilog("node._message_cache size: ${size}", ("size", _message_cache.size()));
@@ -5217,6 +5710,10 @@ std::vector<peer_status> node_impl::get_connected_peers() const
         peer_details["lastrecv"] = peer->get_last_message_received_time().sec_since_epoch();
         peer_details["bytessent"] = peer->get_total_bytes_sent();
         peer_details["bytesrecv"] = peer->get_total_bytes_received();
+        peer_details["bytessaved_sent"] = peer->get_total_bytes_saved_sending();
+        peer_details["bytessaved_recv"] = peer->get_total_bytes_saved_receiving();
+        peer_details["send_queue"] = peer->get_send_queue_stats();
+        peer_details["transactions"] = _received_transactions.get_stats(peer);
         peer_details["conntime"] = peer->get_connection_time();
         peer_details["pingtime"] = "";
         peer_details["pingwait"] = "";
@@ -5346,6 +5843,20 @@ void node_impl::set_advanced_node_parameters(const fc::variant_object& params)
         _maximum_number_of_sync_blocks_to_prefetch = params["maximum_number_of_sync_blocks_to_prefetch"].as<uint32_t>();
     if (params.contains("maximum_blocks_per_peer_during_syncing"))
         _maximum_blocks_per_peer_during_syncing = params["maximum_blocks_per_peer_during_syncing"].as<uint32_t>();
+    if (params.contains("message_compression_threshold"))
+        _message_compression_threshold = params["message_compression_threshold"].as<uint32_t>();
+
+    transaction_rate_limit transaction_limit = _received_transactions.get_limit();
+    if (params.contains("peer_transactions_per_second"))
+        transaction_limit.transactions_per_second = params["peer_transactions_per_second"].as<uint32_t>();
+    if (params.contains("peer_transactions_burst"))
+        transaction_limit.burst = params["peer_transactions_burst"].as<uint32_t>();
+    if (params.contains("maximum_queued_transactions_per_peer"))
+        transaction_limit.max_queued = params["maximum_queued_transactions_per_peer"].as<uint32_t>();
+    _received_transactions.set_limit(transaction_limit);
+    if (params.contains("maximum_number_of_transactions_to_handle_at_one_time"))
+        _maximum_number_of_transactions_to_handle_at_one_time
+            = params["maximum_number_of_transactions_to_handle_at_one_time"].as<uint32_t>();
 
     _desired_number_of_connections = std::min(_desired_number_of_connections, _maximum_number_of_connections);
 
@@ -5364,6 +5875,12 @@ fc::variant_object node_impl::get_advanced_node_parameters()
     result["maximum_number_of_blocks_to_handle_at_one_time"] = _maximum_number_of_blocks_to_handle_at_one_time;
     result["maximum_number_of_sync_blocks_to_prefetch"] = _maximum_number_of_sync_blocks_to_prefetch;
     result["maximum_blocks_per_peer_during_syncing"] = _maximum_blocks_per_peer_during_syncing;
+    result["message_compression_threshold"] = _message_compression_threshold;
+    result["peer_transactions_per_second"] = _received_transactions.get_limit().transactions_per_second;
+    result["peer_transactions_burst"] = _received_transactions.get_limit().burst;
+    result["maximum_queued_transactions_per_peer"] = _received_transactions.get_limit().max_queued;
+    result["maximum_number_of_transactions_to_handle_at_one_time"]
+        = _maximum_number_of_transactions_to_handle_at_one_time;
     return result;
 }
 
@@ -5460,6 +5977,19 @@ fc::variant_object node_impl::network_get_usage_stats() const
     result["usage_by_second"] = network_usage_by_second;
     result["usage_by_minute"] = network_usage_by_minute;
     result["usage_by_hour"] = network_usage_by_hour;
+    result["compact_blocks_received"] = _compact_blocks_received;
+    result["compact_blocks_failed"] = _compact_blocks_failed;
+    result["compact_block_transactions_fetched"] = _compact_block_transactions_fetched;
+
+    uint64_t bytes_saved_sending = 0;
+    uint64_t bytes_saved_receiving = 0;
+    for (const peer_connection_ptr& peer : _active_connections)
+    {
+        bytes_saved_sending += peer->get_total_bytes_saved_sending();
+        bytes_saved_receiving += peer->get_total_bytes_saved_receiving();
+    }
+    result["compression_bytes_saved_sending"] = bytes_saved_sending;
+    result["compression_bytes_saved_receiving"] = bytes_saved_receiving;
     return result;
 }
 
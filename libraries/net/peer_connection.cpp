@@ -76,7 +76,6 @@ size_t peer_connection::virtual_queued_message::get_size_in_queue()
 peer_connection::peer_connection(peer_connection_delegate* delegate)
     : _node(delegate)
     , _message_connection(this)
-    , _total_queued_messages_size(0)
     , direction(peer_connection_direction::unknown)
     , is_firewalled(firewalled_state::unknown)
     , our_state(our_connection_state::disconnected)
@@ -84,6 +83,7 @@ peer_connection::peer_connection(peer_connection_delegate* delegate)
     , their_state(their_connection_state::disconnected)
     , we_have_requested_close(false)
     , negotiation_status(connection_negotiation_status::disconnected)
+    , supports_compact_blocks(false)
     , number_of_unfetched_item_ids(0)
     , peer_needs_sync_items_from_us(true)
     , we_need_sync_items_from_peer(true)
@@ -320,8 +320,10 @@ void peer_connection::send_queued_messages_task()
 #endif
     while (!_queued_messages.empty())
     {
-        _queued_messages.front()->transmission_start_time = fc::time_point::now();
-        message message_to_send = _queued_messages.front()->get_message(_node);
+        // the message leaves the queue before sending, so more urgent messages queued meanwhile can't displace it
+        std::unique_ptr<queued_message> message_being_sent = _queued_messages.pop();
+        message_being_sent->transmission_start_time = fc::time_point::now();
+        message message_to_send = message_being_sent->get_message(_node);
         try
         {
             // dlog("peer_connection::send_queued_messages_task() calling message_oriented_connection::send_message() "
@@ -358,22 +360,29 @@ void peer_connection::send_queued_messages_task()
         {
             elog("message_oriented_exception::send_message() threw an unhandled exception");
         }
-        _queued_messages.front()->transmission_finish_time = fc::time_point::now();
-        _total_queued_messages_size -= _queued_messages.front()->get_size_in_queue();
-        _queued_messages.pop();
+        message_being_sent->transmission_finish_time = fc::time_point::now();
     }
     // dlog("leaving peer_connection::send_queued_messages_task() due to queue exhaustion");
 }
 
-void peer_connection::send_queueable_message(std::unique_ptr<queued_message>&& message_to_send)
+void peer_connection::send_queueable_message(std::unique_ptr<queued_message>&& message_to_send,
+                                             message_priority priority,
+                                             bool solicited)
 {
     VERIFY_CORRECT_THREAD();
-    _total_queued_messages_size += message_to_send->get_size_in_queue();
-    _queued_messages.emplace(std::move(message_to_send));
-    if (_total_queued_messages_size > GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)
+    size_t size = message_to_send->get_size_in_queue();
+    auto result = solicited ? _queued_messages.push_solicited(priority, std::move(message_to_send), size)
+                            : _queued_messages.push(priority, std::move(message_to_send), size);
+    if (result == message_send_queue<queued_message>::push_result::dropped)
+    {
+        dlog("send queue of ${priority} messages is full, dropping message", ("priority", to_string(priority)));
+        return;
+    }
+    if (result == message_send_queue<queued_message>::push_result::overflow)
     {
         elog("send queue exceeded maximum size of ${max} bytes (current size ${current} bytes)",
-             ("max", GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)("current", _total_queued_messages_size));
+             ("max", GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)(
+                 "current", _queued_messages.total_bytes() + size));
         try
         {
             close_connection();
@@ -404,7 +413,14 @@ void peer_connection::send_message(const message& message_to_send, size_t messag
     //     ("type", message_to_send.msg_type)("endpoint", get_remote_endpoint()));
     std::unique_ptr<queued_message> message_to_enqueue(
         new real_queued_message(message_to_send, message_send_time_field_offset));
-    send_queueable_message(std::move(message_to_enqueue));
+    send_queueable_message(std::move(message_to_enqueue), get_message_priority(message_to_send.msg_type));
+}
+
+void peer_connection::send_fetch_reply(const message& reply)
+{
+    VERIFY_CORRECT_THREAD();
+    std::unique_ptr<queued_message> message_to_enqueue(new real_queued_message(reply));
+    send_queueable_message(std::move(message_to_enqueue), get_message_priority(reply.msg_type), true);
 }
 
 void peer_connection::send_item(const item_id& item_to_send)
@@ -413,7 +429,7 @@ void peer_connection::send_item(const item_id& item_to_send)
     // dlog("peer_connection::send_item() enqueueing message of type ${type} for peer ${endpoint}",
     //     ("type", item_to_send.item_type)("endpoint", get_remote_endpoint()));
     std::unique_ptr<queued_message> message_to_enqueue(new virtual_queued_message(item_to_send));
-    send_queueable_message(std::move(message_to_enqueue));
+    send_queueable_message(std::move(message_to_enqueue), get_message_priority(item_to_send.item_type));
 }
 
 void peer_connection::close_connection()
@@ -432,6 +448,12 @@ void peer_connection::destroy_connection()
     destroy();
 }
 
+std::map<std::string, send_queue_stats> peer_connection::get_send_queue_stats() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _queued_messages.get_stats();
+}
+
 uint64_t peer_connection::get_total_bytes_sent() const
 {
     VERIFY_CORRECT_THREAD();
@@ -444,6 +466,24 @@ uint64_t peer_connection::get_total_bytes_received() const
     return _message_connection.get_total_bytes_received();
 }
 
+uint64_t peer_connection::get_total_bytes_saved_sending() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _message_connection.get_total_bytes_saved_sending();
+}
+
+uint64_t peer_connection::get_total_bytes_saved_receiving() const
+{
+    VERIFY_CORRECT_THREAD();
+    return _message_connection.get_total_bytes_saved_receiving();
+}
+
+void peer_connection::enable_compression(uint32_t threshold)
+{
+    VERIFY_CORRECT_THREAD();
+    _message_connection.enable_compression(threshold);
+}
+
 fc::time_point peer_connection::get_last_message_sent_time() const
 {
     VERIFY_CORRECT_THREAD();
@@ -32,14 +32,58 @@
 #include <fc/io/raw_variant.hpp>
 #include <fc/log/logger.hpp>
 #include <fc/io/json.hpp>
+#include <fc/io/datastream.hpp>
 
+#include <graphene/net/config.hpp>
 #include <graphene/net/peer_database.hpp>
 
+#include <fstream>
+#include <sstream>
+
+#define MAXIMUM_PEERDB_SIZE 1000
+
 namespace graphene {
 namespace net {
 namespace detail {
 using namespace boost::multi_index;
 
+namespace {
+
+/**
+ * The binary file starts with the magic and the version followed by records. A record is its size and the packed
+ * type with the updated potential_peer_record or the erased endpoint. A record of an endpoint overrides the former
+ * ones, so changes are appended and the file is rewritten only to drop overridden records.
+ */
+const uint32_t peer_database_magic = 0x52454550; // "PEER"
+const uint32_t peer_database_version = 1;
+
+enum peer_database_record_type : uint8_t
+{
+    update_record = 0,
+    erase_record = 1
+};
+
+void write_header(std::ostream& out)
+{
+    out.write((const char*)&peer_database_magic, sizeof(peer_database_magic));
+    out.write((const char*)&peer_database_version, sizeof(peer_database_version));
+}
+
+template <typename T> void write_record(std::ostream& out, peer_database_record_type type, const T& value)
+{
+    uint8_t packed_type = type;
+    uint32_t size = (uint32_t)(fc::raw::pack_size(packed_type) + fc::raw::pack_size(value));
+
+    std::vector<char> data(size);
+    fc::datastream<char*> ds(data.data(), data.size());
+    fc::raw::pack(ds, packed_type);
+    fc::raw::pack(ds, value);
+
+    out.write((const char*)&size, sizeof(size));
+    out.write(data.data(), data.size());
+}
+}
+
 class peer_database_impl
 {
 public:
@@ -65,10 +109,33 @@ private:
     potential_peer_set _potential_peer_set;
     fc::path _peer_database_filename;
 
+    std::ofstream _log;
+    /// records in the file and in the batch, overridden ones included
+    size_t _log_records = 0;
+
+    /// records appended since the last flush
+    std::ostringstream _batch;
+    bool _batch_empty = true;
+    fc::time_point _last_flush;
+
+    bool load_log();
+    void load_json(const fc::path& json_filename);
+    void apply_record(const std::vector<char>& data);
+    void apply_update(const potential_peer_record& updatedRecord);
+    void apply_erase(const fc::ip::endpoint& endpointToErase);
+    void prune();
+
+    void open_log();
+    template <typename T> void append(peer_database_record_type type, const T& value);
+    void compact();
+
 public:
-    void open(const fc::path& databaseFilename);
+    ~peer_database_impl();
+
+    void open(const fc::path& databaseFilename, const fc::path& legacyJsonFilename);
     void close();
     void clear();
+    void flush();
     void erase(const fc::ip::endpoint& endpointToErase);
     void update_entry(const potential_peer_record& updatedRecord);
     potential_peer_record lookup_or_create_entry_for_endpoint(const fc::ip::endpoint& endpointToLookup);
@@ -95,75 +162,282 @@ peer_database_iterator::peer_database_iterator(const peer_database_iterator& c)
 {
 }
 
-void peer_database_impl::open(const fc::path& peer_database_filename)
+peer_database_impl::~peer_database_impl()
+{
+    close();
+}
+
+void peer_database_impl::open(const fc::path& peer_database_filename, const fc::path& legacy_json_filename)
 {
+    close();
     _peer_database_filename = peer_database_filename;
-    if (fc::exists(_peer_database_filename))
+
+    bool consistent = false;
+    try
+    {
+        if (fc::exists(_peer_database_filename))
+        {
+            consistent = load_log();
+        }
+        else if (!legacy_json_filename.empty() && fc::exists(legacy_json_filename))
+        {
+            // the JSON file is left in place for older versions
+            ilog("migrating peer database from ${json_filename} to ${peer_database_filename}",
+                 ("json_filename", legacy_json_filename)("peer_database_filename", _peer_database_filename));
+            load_json(legacy_json_filename);
+        }
+    }
+    catch (const fc::exception&)
     {
+        elog("error opening peer database file ${peer_database_filename}, starting with a clean database",
+             ("peer_database_filename", _peer_database_filename));
+        _potential_peer_set.clear();
+        consistent = false;
+    }
+
+    prune();
+
+    if (consistent && _log_records == _potential_peer_set.size())
+        open_log();
+    else
+        compact();
+}
+
+bool peer_database_impl::load_log()
+{
+    std::ifstream in(_peer_database_filename.generic_string(), std::ios::in | std::ios::binary);
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    in.read((char*)&magic, sizeof(magic));
+    in.read((char*)&version, sizeof(version));
+    FC_ASSERT(in && magic == peer_database_magic && version == peer_database_version,
+              "Unknown peer database file format", ("magic", magic)("version", version));
+
+    std::vector<char> data;
+    while (true)
+    {
+        uint32_t size = 0;
+        in.read((char*)&size, sizeof(size));
+        if (in.gcount() == 0 && in.eof())
+            return true;
+
+        // the tail of a record written when the node crashed
+        if (!in || size > MAX_MESSAGE_SIZE)
+            break;
+
+        data.resize(size);
+        in.read(data.data(), size);
+        if (!in)
+            break;
+
         try
         {
-            std::vector<potential_peer_record> peer_records
-                = fc::json::from_file(_peer_database_filename).as<std::vector<potential_peer_record>>();
-            std::copy(peer_records.begin(), peer_records.end(),
-                      std::inserter(_potential_peer_set, _potential_peer_set.end()));
-#define MAXIMUM_PEERDB_SIZE 1000
-            if (_potential_peer_set.size() > MAXIMUM_PEERDB_SIZE)
-            {
-                // prune database to a reasonable size
-                auto iter = _potential_peer_set.begin();
-                std::advance(iter, MAXIMUM_PEERDB_SIZE);
-                _potential_peer_set.erase(iter, _potential_peer_set.end());
-            }
+            apply_record(data);
         }
         catch (const fc::exception&)
         {
-            elog("error opening peer database file ${peer_database_filename}, starting with a clean database",
-                 ("peer_database_filename", _peer_database_filename));
+            break;
         }
+        ++_log_records;
     }
+
+    wlog("peer database file ${peer_database_filename} is truncated after ${records} records",
+         ("peer_database_filename", _peer_database_filename)("records", _log_records));
+    return false;
 }
 
-void peer_database_impl::close()
+void peer_database_impl::load_json(const fc::path& json_filename)
 {
-    std::vector<potential_peer_record> peer_records;
-    peer_records.reserve(_potential_peer_set.size());
-    std::copy(_potential_peer_set.begin(), _potential_peer_set.end(), std::back_inserter(peer_records));
+    std::vector<potential_peer_record> peer_records
+        = fc::json::from_file(json_filename).as<std::vector<potential_peer_record>>();
+    std::copy(peer_records.begin(), peer_records.end(), std::inserter(_potential_peer_set, _potential_peer_set.end()));
+}
+
+void peer_database_impl::apply_record(const std::vector<char>& data)
+{
+    fc::datastream<const char*> ds(data.data(), data.size());
+
+    uint8_t type = 0;
+    fc::raw::unpack(ds, type);
+
+    switch (type)
+    {
+    case update_record:
+    {
+        potential_peer_record record;
+        fc::raw::unpack(ds, record);
+        apply_update(record);
+        break;
+    }
+    case erase_record:
+    {
+        fc::ip::endpoint endpoint;
+        fc::raw::unpack(ds, endpoint);
+        apply_erase(endpoint);
+        break;
+    }
+    default:
+        FC_THROW("Unknown peer database record type ${type}", ("type", type));
+    }
+}
 
+void peer_database_impl::apply_update(const potential_peer_record& updatedRecord)
+{
+    auto iter = _potential_peer_set.get<endpoint_index>().find(updatedRecord.endpoint);
+    if (iter != _potential_peer_set.get<endpoint_index>().end())
+        _potential_peer_set.get<endpoint_index>().modify(
+            iter, [&updatedRecord](potential_peer_record& record) { record = updatedRecord; });
+    else
+        _potential_peer_set.get<endpoint_index>().insert(updatedRecord);
+}
+
+void peer_database_impl::apply_erase(const fc::ip::endpoint& endpointToErase)
+{
+    auto iter = _potential_peer_set.get<endpoint_index>().find(endpointToErase);
+    if (iter != _potential_peer_set.get<endpoint_index>().end())
+        _potential_peer_set.get<endpoint_index>().erase(iter);
+}
+
+void peer_database_impl::prune()
+{
+    if (_potential_peer_set.size() > MAXIMUM_PEERDB_SIZE)
+    {
+        // prune database to a reasonable size
+        auto iter = _potential_peer_set.begin();
+        std::advance(iter, MAXIMUM_PEERDB_SIZE);
+        _potential_peer_set.erase(iter, _potential_peer_set.end());
+    }
+}
+
+void peer_database_impl::open_log()
+{
+    try
+    {
+        _log.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+        _log.open(_peer_database_filename.generic_string(), std::ios::out | std::ios::binary | std::ios::app);
+    }
+    catch (const std::exception& e)
+    {
+        elog("error opening peer database file ${peer_database_filename} for writing: ${e}",
+             ("peer_database_filename", _peer_database_filename)("e", e.what()));
+        _log.close();
+    }
+}
+
+template <typename T> void peer_database_impl::append(peer_database_record_type type, const T& value)
+{
+    if (!_log.is_open())
+        return;
+
+    write_record(_batch, type, value);
+    _batch_empty = false;
+    ++_log_records;
+
+    if (_log_records > std::max<size_t>(GRAPHENE_PEER_DATABASE_MIN_COMPACTION_RECORDS, 2 * _potential_peer_set.size()))
+        compact();
+    else if (fc::time_point::now() - _last_flush >= fc::seconds(GRAPHENE_PEER_DATABASE_FLUSH_INTERVAL))
+        flush();
+}
+
+void peer_database_impl::flush()
+{
+    _last_flush = fc::time_point::now();
+
+    if (_batch_empty || !_log.is_open())
+        return;
+
+    try
+    {
+        _log << _batch.rdbuf();
+        _log.flush();
+    }
+    catch (const std::exception& e)
+    {
+        elog("error saving peer database to file ${peer_database_filename}: ${e}",
+             ("peer_database_filename", _peer_database_filename)("e", e.what()));
+        _log.close();
+    }
+
+    _batch.str(std::string());
+    _batch.clear();
+    _batch_empty = true;
+}
+
+void peer_database_impl::compact()
+{
+    _log.close();
+
+    // the batch is a part of the records written below
+    _batch.str(std::string());
+    _batch.clear();
+    _batch_empty = true;
+    _last_flush = fc::time_point::now();
+
+    fc::path tmp_filename = _peer_database_filename.generic_string() + ".tmp";
     try
     {
         fc::path peer_database_filename_dir = _peer_database_filename.parent_path();
-        if (!fc::exists(peer_database_filename_dir))
+        if (!peer_database_filename_dir.empty() && !fc::exists(peer_database_filename_dir))
             fc::create_directories(peer_database_filename_dir);
-        fc::json::save_to_file(peer_records, _peer_database_filename);
+
+        {
+            std::ofstream out;
+            out.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+            out.open(tmp_filename.generic_string(), std::ios::out | std::ios::binary | std::ios::trunc);
+
+            write_header(out);
+            for (const potential_peer_record& record : _potential_peer_set)
+                write_record(out, update_record, record);
+        }
+        fc::rename(tmp_filename, _peer_database_filename);
     }
     catch (const fc::exception& e)
     {
-        elog("error saving peer database to file ${peer_database_filename}",
-             ("peer_database_filename", _peer_database_filename));
+        elog("error saving peer database to file ${peer_database_filename}: ${e}",
+             ("peer_database_filename", _peer_database_filename)("e", e.to_detail_string()));
+        return;
+    }
+    catch (const std::exception& e)
+    {
+        elog("error saving peer database to file ${peer_database_filename}: ${e}",
+             ("peer_database_filename", _peer_database_filename)("e", e.what()));
+        return;
     }
+
+    _log_records = _potential_peer_set.size();
+    open_log();
+}
+
+void peer_database_impl::close()
+{
+    flush();
+    _log.close();
+    _log_records = 0;
     _potential_peer_set.clear();
 }
 
 void peer_database_impl::clear()
 {
     _potential_peer_set.clear();
+    if (_log.is_open())
+        compact();
 }
 
 void peer_database_impl::erase(const fc::ip::endpoint& endpointToErase)
 {
     auto iter = _potential_peer_set.get<endpoint_index>().find(endpointToErase);
     if (iter != _potential_peer_set.get<endpoint_index>().end())
+    {
         _potential_peer_set.get<endpoint_index>().erase(iter);
+        append(erase_record, endpointToErase);
+    }
 }
 
 void peer_database_impl::update_entry(const potential_peer_record& updatedRecord)
 {
-    auto iter = _potential_peer_set.get<endpoint_index>().find(updatedRecord.endpoint);
-    if (iter != _potential_peer_set.get<endpoint_index>().end())
-        _potential_peer_set.get<endpoint_index>().modify(
-            iter, [&updatedRecord](potential_peer_record& record) { record = updatedRecord; });
-    else
-        _potential_peer_set.get<endpoint_index>().insert(updatedRecord);
+    apply_update(updatedRecord);
+    append(update_record, updatedRecord);
 }
 
 potential_peer_record peer_database_impl::lookup_or_create_entry_for_endpoint(const fc::ip::endpoint& endpointToLookup)
@@ -239,9 +513,9 @@ peer_database::~peer_database()
 {
 }
 
-void peer_database::open(const fc::path& databaseFilename)
+void peer_database::open(const fc::path& databaseFilename, const fc::path& legacyJsonFilename)
 {
-    my->open(databaseFilename);
+    my->open(databaseFilename, legacyJsonFilename);
 }
 
 void peer_database::close()
@@ -254,6 +528,11 @@ void peer_database::clear()
     my->clear();
 }
 
+void peer_database::flush()
+{
+    my->flush();
+}
+
 void peer_database::erase(const fc::ip::endpoint& endpointToErase)
 {
     my->erase(endpointToErase);
@@ -0,0 +1,47 @@
+#include <graphene/net/transaction_fair_queue.hpp>
+
+#include <cmath>
+
+namespace graphene {
+namespace net {
+
+bool token_bucket::consume(const transaction_rate_limit& limit, const fc::time_point& now)
+{
+    if (limit.transactions_per_second == 0)
+        return true;
+
+    if (_tokens < 0)
+    {
+        _tokens = limit.burst;
+    }
+    else if (now > _last_refill)
+    {
+        double elapsed_seconds = (now - _last_refill).count() / 1000000.0;
+        _tokens = std::min<double>(limit.burst, _tokens + elapsed_seconds * limit.transactions_per_second);
+    }
+    _last_refill = std::max(now, _last_refill);
+
+    if (_tokens < 1)
+        return false;
+
+    _tokens -= 1;
+    return true;
+}
+
+void token_bucket::refund(const transaction_rate_limit& limit)
+{
+    if (limit.transactions_per_second == 0 || _tokens < 0)
+        return;
+
+    _tokens = std::min<double>(limit.burst, _tokens + 1);
+}
+
+fc::time_point token_bucket::next_token_time(const transaction_rate_limit& limit) const
+{
+    if (limit.transactions_per_second == 0 || _tokens < 0 || _tokens >= 1)
+        return _last_refill;
+
+    return _last_refill + fc::microseconds((int64_t)std::ceil((1 - _tokens) * 1000000 / limit.transactions_per_second));
+}
+}
+}
@@ -0,0 +1,80 @@
+#include <scorum/account_bets/account_bets_api.hpp>
+#include <scorum/account_bets/account_bets_objects.hpp>
+
+#include <scorum/chain/schema/bet_objects.hpp>
+#include <scorum/common_api/config_api.hpp>
+
+namespace scorum {
+namespace account_bets {
+
+namespace detail {
+
+class account_bets_api_impl
+{
+public:
+    account_bets_api_impl(scorum::app::application& app)
+        : _app(app)
+    {
+    }
+
+    template <typename TApiObject, typename TObject>
+    std::vector<TApiObject>
+    get_account_bets(const account_name_type& better, bet_kind kind, oid<TObject> from, uint32_t limit) const;
+
+    scorum::app::application& _app;
+};
+
+template <typename TApiObject, typename TObject>
+std::vector<TApiObject> account_bets_api_impl::get_account_bets(const account_name_type& better,
+                                                                bet_kind kind,
+                                                                oid<TObject> from,
+                                                                uint32_t limit) const
+{
+    FC_ASSERT(limit <= LOOKUP_LIMIT, "Limit should be le than LOOKUP_LIMIT",
+              ("limit", limit)("LOOKUP_LIMIT", LOOKUP_LIMIT));
+
+    const auto& db = *_app.chain_database();
+    const auto& idx = db.get_index<account_bet_index>().indices().get<by_better_bet>();
+
+    std::vector<TApiObject> result;
+
+    // links of settled bets stay until the end of the block, skip them
+    for (auto it = idx.lower_bound(std::make_tuple(better, kind, from._id));
+         it != idx.end() && it->better == better && it->kind == kind && result.size() < limit; ++it)
+    {
+        auto bet = db.find<TObject>(oid<TObject>(it->bet_id));
+        if (bet != nullptr)
+            result.emplace_back(*bet);
+    }
+
+    return result;
+}
+
+} // detail
+
+account_bets_api::account_bets_api(const scorum::app::api_context& ctx)
+{
+    my = std::make_shared<detail::account_bets_api_impl>(ctx.app);
+}
+
+void account_bets_api::on_api_startup()
+{
+}
+
+std::vector<app::matched_bet_api_object>
+account_bets_api::get_account_matched_bets(const account_name_type& better, matched_bet_id_type from, uint32_t limit) const
+{
+    return my->_app.chain_database()->with_read_lock([&]() {
+        return my->get_account_bets<app::matched_bet_api_object>(better, bet_kind::matched, from, limit);
+    });
+}
+
+std::vector<app::pending_bet_api_object>
+account_bets_api::get_account_pending_bets(const account_name_type& better, pending_bet_id_type from, uint32_t limit) const
+{
+    return my->_app.chain_database()->with_read_lock([&]() {
+        return my->get_account_bets<app::pending_bet_api_object>(better, bet_kind::pending, from, limit);
+    });
+}
+}
+} // scorum::account_bets
@@ -0,0 +1,204 @@
+#include <scorum/account_bets/account_bets_plugin.hpp>
+#include <scorum/account_bets/account_bets_objects.hpp>
+#include <scorum/account_bets/account_bets_api.hpp>
+
+#include <scorum/chain/schema/bet_objects.hpp>
+#include <scorum/chain/database/database.hpp>
+#include <scorum/chain/operation_notification.hpp>
+
+#include <boost/container/flat_set.hpp>
+
+namespace scorum {
+namespace account_bets {
+
+namespace detail {
+
+class account_bets_plugin_impl
+{
+public:
+    account_bets_plugin_impl(account_bets_plugin& _plugin)
+        : _self(_plugin)
+    {
+    }
+
+    scorum::chain::database& database()
+    {
+        return _self.database();
+    }
+
+    void post_operation(const operation_notification& note);
+    void on_applied_block();
+
+    void track_pending_bet(const uuid_type& bet_uuid);
+    void track_matched_bet(const matched_bet_id_type& id);
+    void track_bet(const account_name_type& better, const uuid_type& game_uuid, bet_kind kind, int64_t bet_id);
+
+    /// links of settled bets are dropped once per block for every game which had bets removed
+    void touch_game(const uuid_type& game_uuid);
+    void drop_settled_bets(const uuid_type& game_uuid);
+
+    boost::container::flat_set<uuid_type> _touched_games;
+    account_bets_plugin& _self;
+};
+
+struct post_operation_visitor
+{
+    account_bets_plugin_impl& _impl;
+
+    post_operation_visitor(account_bets_plugin_impl& impl)
+        : _impl(impl)
+    {
+    }
+
+    template <typename T> void operator()(const T&) const
+    {
+    }
+
+    void operator()(const post_bet_operation& op) const
+    {
+        _impl.track_pending_bet(op.uuid);
+    }
+
+    void operator()(const bets_matched_operation& op) const
+    {
+        // fully matched pending bets are removed without their own notification
+        _impl.track_matched_bet(matched_bet_id_type(op.matched_bet_id));
+    }
+
+    void operator()(const bet_restored_operation& op) const
+    {
+        _impl.track_pending_bet(op.bet_uuid);
+        _impl.touch_game(op.game_uuid);
+    }
+
+    void operator()(const bet_cancelled_operation& op) const
+    {
+        _impl.touch_game(op.game_uuid);
+    }
+
+    void operator()(const bet_resolved_operation& op) const
+    {
+        _impl.touch_game(op.game_uuid);
+    }
+
+    void operator()(const game_status_changed_operation& op) const
+    {
+        _impl.touch_game(op.game_uuid);
+    }
+};
+
+void account_bets_plugin_impl::post_operation(const operation_notification& note)
+{
+    note.op.visit(post_operation_visitor(*this));
+}
+
+void account_bets_plugin_impl::on_applied_block()
+{
+    for (const auto& game_uuid : _touched_games)
+        drop_settled_bets(game_uuid);
+
+    _touched_games.clear();
+}
+
+void account_bets_plugin_impl::track_pending_bet(const uuid_type& bet_uuid)
+{
+    auto bet = database().find<pending_bet_object, by_uuid>(bet_uuid);
+    if (bet != nullptr)
+        track_bet(bet->data.better, bet->game_uuid, bet_kind::pending, bet->id._id);
+}
+
+void account_bets_plugin_impl::track_matched_bet(const matched_bet_id_type& id)
+{
+    auto bet = database().find<matched_bet_object>(id);
+    if (bet == nullptr)
+        return;
+
+    track_bet(bet->bet1_data.better, bet->game_uuid, bet_kind::matched, bet->id._id);
+    track_bet(bet->bet2_data.better, bet->game_uuid, bet_kind::matched, bet->id._id);
+    touch_game(bet->game_uuid);
+}
+
+void account_bets_plugin_impl::track_bet(const account_name_type& better,
+                                         const uuid_type& game_uuid,
+                                         bet_kind kind,
+                                         int64_t bet_id)
+{
+    auto& db = database();
+
+    if (db.find<account_bet_object, by_better_bet>(std::make_tuple(better, kind, bet_id)) != nullptr)
+        return;
+
+    db.create<account_bet_object>([&](account_bet_object& o) {
+        o.better = better;
+        o.game_uuid = game_uuid;
+        o.kind = kind;
+        o.bet_id = bet_id;
+    });
+}
+
+void account_bets_plugin_impl::touch_game(const uuid_type& game_uuid)
+{
+    _touched_games.insert(game_uuid);
+}
+
+void account_bets_plugin_impl::drop_settled_bets(const uuid_type& game_uuid)
+{
+    auto& db = database();
+
+    const auto& idx = db.get_index<account_bet_index>().indices().get<by_game_bet>();
+
+    std::vector<std::reference_wrapper<const account_bet_object>> settled;
+    for (auto it = idx.lower_bound(game_uuid); it != idx.end() && it->game_uuid == game_uuid; ++it)
+    {
+        bool exists = it->kind == bet_kind::pending
+            ? db.find<pending_bet_object>(pending_bet_id_type(it->bet_id)) != nullptr
+            : db.find<matched_bet_object>(matched_bet_id_type(it->bet_id)) != nullptr;
+
+        if (!exists)
+            settled.emplace_back(*it);
+    }
+
+    for (const account_bet_object& obj : settled)
+        db.remove(obj);
+}
+
+} // detail
+
+account_bets_plugin::account_bets_plugin(scorum::app::application* app)
+    : plugin(app)
+    , my(new detail::account_bets_plugin_impl(*this))
+{
+}
+
+account_bets_plugin::~account_bets_plugin()
+{
+}
+
+void account_bets_plugin::plugin_set_program_options(boost::program_options::options_description& cli,
+                                                     boost::program_options::options_description& cfg)
+{
+}
+
+void account_bets_plugin::plugin_initialize(const boost::program_options::variables_map& options)
+{
+    try
+    {
+        chain::database& db = database();
+
+        db.post_apply_operation.connect([&](const operation_notification& o) { my->post_operation(o); });
+        db.applied_block.connect([&](const signed_block&) { my->on_applied_block(); });
+
+        db.add_plugin_index<account_bet_index>();
+    }
+    FC_CAPTURE_AND_RETHROW()
+    print_greeting();
+}
+
+void account_bets_plugin::plugin_startup()
+{
+    app().register_api_factory<account_bets_api>(API_ACCOUNT_BETS);
+}
+}
+} // scorum::account_bets
+
+SCORUM_DEFINE_PLUGIN(account_bets, scorum::account_bets::account_bets_plugin)
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <scorum/app/application.hpp>
+#include <scorum/app/betting_api_objects.hpp>
+
+#include <scorum/account_bets/account_bets_objects.hpp>
+
+#include <fc/api.hpp>
+
+#ifndef API_ACCOUNT_BETS
+#define API_ACCOUNT_BETS "account_bets_api"
+#endif
+
+namespace scorum {
+namespace account_bets {
+
+namespace detail {
+class account_bets_api_impl;
+}
+
+/**
+ * @brief Allows find bets of an account across all games
+ *
+ * Require: account_bets_plugin
+ *
+ * @ingroup api
+ * @ingroup account_bets_plugin
+ * @addtogroup account_bets_api Account bets API
+ */
+class account_bets_api
+{
+public:
+    account_bets_api(const app::api_context& ctx);
+
+    void on_api_startup();
+
+    /// @name Public API
+    /// @addtogroup account_bets_api
+    /// @{
+
+    /**
+     * @brief Returns matched bets of an account across all games
+     * @param better account which made one of the matched pending bets
+     * @param from lower bound bet id
+     * @param limit query limit
+     * @return array of matched_bet_api_object's ordered by id
+     */
+    std::vector<app::matched_bet_api_object>
+    get_account_matched_bets(const account_name_type& better, matched_bet_id_type from, uint32_t limit) const;
+
+    /**
+     * @brief Returns pending bets of an account across all games
+     * @param better account which made the bets
+     * @param from lower bound bet id
+     * @param limit query limit
+     * @return array of pending_bet_api_object's ordered by id
+     */
+    std::vector<app::pending_bet_api_object>
+    get_account_pending_bets(const account_name_type& better, pending_bet_id_type from, uint32_t limit) const;
+
+    /// @}
+
+private:
+    std::shared_ptr<detail::account_bets_api_impl> my;
+};
+}
+} // scorum::account_bets
+
+FC_API(scorum::account_bets::account_bets_api, (get_account_matched_bets)(get_account_pending_bets))
@@ -0,0 +1,72 @@
+#pragma once
+#include <scorum/chain/schema/scorum_object_types.hpp>
+#include <scorum/protocol/scorum_virtual_operations.hpp>
+
+#include <boost/multi_index/composite_key.hpp>
+
+namespace scorum {
+namespace account_bets {
+
+using namespace scorum::chain;
+
+#ifndef ACCOUNT_BETS_SPACE_ID
+#define ACCOUNT_BETS_SPACE_ID 13
+#endif
+
+enum account_bets_object_types
+{
+    account_bet_object_type = (ACCOUNT_BETS_SPACE_ID << 8)
+};
+
+/// links a better with one of its pending or matched bets, a matched bet is linked with both betters
+class account_bet_object : public object<account_bet_object_type, account_bet_object>
+{
+public:
+    CHAINBASE_DEFAULT_CONSTRUCTOR(account_bet_object)
+
+    id_type id;
+
+    account_name_type better;
+    uuid_type game_uuid;
+    protocol::bet_kind kind = protocol::bet_kind::pending;
+    /// id of pending_bet_object or matched_bet_object depending on kind
+    int64_t bet_id = 0;
+};
+
+typedef account_bet_object::id_type account_bet_id_type;
+
+using namespace boost::multi_index;
+
+struct by_better_bet;
+struct by_game_bet;
+
+typedef shared_multi_index_container<account_bet_object,
+                                     indexed_by<ordered_unique<tag<by_id>,
+                                                               member<account_bet_object,
+                                                                      account_bet_id_type,
+                                                                      &account_bet_object::id>>,
+                                                ordered_unique<tag<by_better_bet>,
+                                                               composite_key<account_bet_object,
+                                                                             member<account_bet_object,
+                                                                                    account_name_type,
+                                                                                    &account_bet_object::better>,
+                                                                             member<account_bet_object,
+                                                                                    protocol::bet_kind,
+                                                                                    &account_bet_object::kind>,
+                                                                             member<account_bet_object,
+                                                                                    int64_t,
+                                                                                    &account_bet_object::bet_id>>>,
+                                                ordered_unique<tag<by_game_bet>,
+                                                               composite_key<account_bet_object,
+                                                                             member<account_bet_object,
+                                                                                    uuid_type,
+                                                                                    &account_bet_object::game_uuid>,
+                                                                             member<account_bet_object,
+                                                                                    account_bet_id_type,
+                                                                                    &account_bet_object::id>>>>>
+    account_bet_index;
+}
+} // scorum::account_bets
+
+FC_REFLECT(scorum::account_bets::account_bet_object, (id)(better)(game_uuid)(kind)(bet_id))
+CHAINBASE_SET_INDEX_TYPE(scorum::account_bets::account_bet_object, scorum::account_bets::account_bet_index)
@@ -0,0 +1,42 @@
+#pragma once
+#include <scorum/app/plugin.hpp>
+#include <scorum/chain/database/database.hpp>
+
+namespace scorum {
+namespace account_bets {
+
+#define ACCOUNT_BETS_PLUGIN_NAME "account_bets"
+
+namespace detail {
+class account_bets_plugin_impl;
+}
+
+/**
+ * @brief This plugin tracks pending and matched bets of each account
+ *
+ * Bets are linked to accounts from the operation notifications, so bets made before the plugin was enabled are never
+ * listed. Enabling the plugin on an existing state needs a replay of the blockchain.
+ *
+ * @ingroup plugins
+ * @addtogroup account_bets_plugin Account bets plugin
+ */
+class account_bets_plugin : public scorum::app::plugin
+{
+public:
+    account_bets_plugin(scorum::app::application* app);
+    ~account_bets_plugin();
+
+    std::string plugin_name() const override
+    {
+        return ACCOUNT_BETS_PLUGIN_NAME;
+    }
+    virtual void plugin_set_program_options(boost::program_options::options_description& cli,
+                                            boost::program_options::options_description& cfg) override;
+    virtual void plugin_initialize(const boost::program_options::variables_map& options) override;
+    virtual void plugin_startup() override;
+
+    friend class detail::account_bets_plugin_impl;
+    std::unique_ptr<detail::account_bets_plugin_impl> my;
+};
+}
+} // scorum::account_bets
@@ -346,7 +346,12 @@ annotated_signed_transaction blockchain_history_api::get_transaction(transaction
 
 optional<block_header> blockchain_history_api::get_block_header(uint32_t block_num) const
 {
-    return _impl->_db->with_read_lock([&]() { return _impl->get_block(block_num); });
+    return _impl->_app.get_api_response_cache().get(API_BLOCKCHAIN_HISTORY, "get_block_header",
+                                                    [&]() -> optional<block_header> {
+                                                        return _impl->_db->with_read_lock(
+                                                            [&]() { return _impl->get_block(block_num); });
+                                                    },
+                                                    block_num);
 }
 
 optional<signed_block_api_obj> blockchain_history_api::get_block(uint32_t block_num) const
@@ -444,6 +444,25 @@ void blockchain_monitoring_plugin::plugin_startup()
     app().register_api_factory<node_monitoring_api>(API_NODE_MONITORING);
 }
 
+void blockchain_monitoring_plugin::plugin_shutdown()
+{
+    auto& db = database();
+
+    auto operation_timings = db.with_read_lock([&]() { return db.get_operation_timing_stats(); });
+    if (!operation_timings.empty())
+        ilog("Operation evaluator timings (us): ${t}", ("t", operation_timings));
+
+    auto block_timings = db.with_read_lock([&]() { return db.get_block_timing_stats(); });
+    if (!block_timings.empty())
+        ilog("Block application timings (us): ${t}", ("t", block_timings));
+
+    auto signature_cache_stats = db.with_read_lock([&]() { return db.get_signature_cache().get_stats(); });
+    ilog("Signature cache: ${s}", ("s", signature_cache_stats));
+
+    auto expiration_stats = db.with_read_lock([&]() { return db.get_expiration_scheduler().get_stats(); });
+    ilog("Expired objects: ${e}", ("e", expiration_stats));
+}
+
 const flat_set<uint32_t>& blockchain_monitoring_plugin::get_tracked_buckets() const
 {
     return _my->_tracked_buckets;
@@ -36,6 +36,7 @@ public:
                                             boost::program_options::options_description& cfg) override;
     virtual void plugin_initialize(const boost::program_options::variables_map& options) override;
     virtual void plugin_startup() override;
+    virtual void plugin_shutdown() override;
 
     const flat_set<uint32_t>& get_tracked_buckets() const;
     uint32_t get_max_history_per_bucket() const;
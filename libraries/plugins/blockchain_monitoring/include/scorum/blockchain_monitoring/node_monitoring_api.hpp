@@ -2,6 +2,14 @@
 
 #include <fc/api.hpp>
 
+#include <scorum/chain/block_timing.hpp>
+#include <scorum/chain/operation_timing.hpp>
+#include <scorum/chain/signature_cache.hpp>
+#include <scorum/chain/expiration_scheduler.hpp>
+
+#include <scorum/app/api_response_cache.hpp>
+#include <scorum/app/transaction_prevalidator.hpp>
+
 #ifndef API_NODE_MONITORING
 #define API_NODE_MONITORING "node_monitoring_api"
 #endif
@@ -47,6 +55,42 @@ public:
     uint32_t get_free_shared_memory_mb() const;
     uint32_t get_total_shared_memory_mb() const;
 
+    /**
+    * @brief Returns durations of block application stages in microseconds.
+    *
+    * Chain phases of block application are named "phase.<name>" ("phase.apply_block" covers the whole block),
+    * block tasks are named "task.<task class>". Statistics are calculated over the last 1200 applied blocks.
+    */
+    scorum::chain::block_timing::stats_map get_block_timing_stats() const;
+
+    /**
+    * @brief Returns evaluation counters and latency histograms per operation type since node start.
+    *
+    * Histogram bucket N counts evaluations which took less than 2^N microseconds.
+    */
+    scorum::chain::operation_timing::stats_map get_operation_timing_stats() const;
+
+    /**
+    * @brief Returns counters of the cache of public keys recovered from transaction signatures since node start.
+    */
+    scorum::chain::signature_cache::stats get_signature_cache_stats() const;
+
+    /**
+    * @brief Returns counters of objects expired per type (transactions, delegations, proposals, ...) since node start.
+    */
+    scorum::chain::expiration_scheduler::stats_map get_expiration_stats() const;
+
+    /**
+    * @brief Returns hits, misses and sizes of the API response cache per cached method.
+    */
+    scorum::app::api_response_cache::stats_map get_api_cache_stats() const;
+
+    /**
+    * @brief Returns passed and rejected transactions and durations per stage of the checks of transactions received
+    * from the network, and rejections per reason, since node start.
+    */
+    scorum::app::transaction_prevalidator::stats get_transaction_prevalidation_stats() const;
+
     /// @}
 
 private:
@@ -56,4 +100,6 @@ private:
 } // namespace scorum
 
 FC_API(scorum::blockchain_monitoring::node_monitoring_api,
-       (get_last_block_duration_microseconds)(get_free_shared_memory_mb)(get_total_shared_memory_mb))
+       (get_last_block_duration_microseconds)(get_free_shared_memory_mb)(get_total_shared_memory_mb)(
+           get_block_timing_stats)(get_operation_timing_stats)(get_signature_cache_stats)(
+           get_expiration_stats)(get_api_cache_stats)(get_transaction_prevalidation_stats))
@@ -54,5 +54,41 @@ uint32_t node_monitoring_api::get_total_shared_memory_mb() const
         [&]() { return uint32_t(_my->_app.chain_database()->get_size() / (1024 * 1024)); });
 }
 
+scorum::chain::block_timing::stats_map node_monitoring_api::get_block_timing_stats() const
+{
+    return _my->_app.chain_database()->with_read_lock(
+        [&]() { return _my->_app.chain_database()->get_block_timing_stats(); });
+}
+
+scorum::chain::operation_timing::stats_map node_monitoring_api::get_operation_timing_stats() const
+{
+    return _my->_app.chain_database()->with_read_lock(
+        [&]() { return _my->_app.chain_database()->get_operation_timing_stats(); });
+}
+
+scorum::chain::signature_cache::stats node_monitoring_api::get_signature_cache_stats() const
+{
+    return _my->_app.chain_database()->with_read_lock(
+        [&]() { return _my->_app.chain_database()->get_signature_cache().get_stats(); });
+}
+
+scorum::chain::expiration_scheduler::stats_map node_monitoring_api::get_expiration_stats() const
+{
+    return _my->_app.chain_database()->with_read_lock(
+        [&]() { return _my->_app.chain_database()->get_expiration_scheduler().get_stats(); });
+}
+
+scorum::app::api_response_cache::stats_map node_monitoring_api::get_api_cache_stats() const
+{
+    // the cache has its own lock
+    return _my->_app.get_api_response_cache().get_stats();
+}
+
+scorum::app::transaction_prevalidator::stats node_monitoring_api::get_transaction_prevalidation_stats() const
+{
+    // the prevalidator has its own lock
+    return _my->_app.get_transaction_prevalidation_stats();
+}
+
 } // namespace blockchain_monitoring
 } // namespace scorum
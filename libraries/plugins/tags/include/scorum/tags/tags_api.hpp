@@ -10,6 +10,10 @@ class database_guard;
 }
 
 namespace scorum {
+namespace app {
+class api_response_cache;
+}
+
 namespace tags {
 
 class tags_api_impl;
@@ -29,6 +33,8 @@ class tags_api : public std::enable_shared_from_this<tags_api>
 
     std::shared_ptr<chainbase::database_guard> _guard;
 
+    app::api_response_cache& _cache;
+
     chainbase::database_guard& guard() const;
 
 public:
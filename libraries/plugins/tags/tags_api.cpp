@@ -17,6 +17,7 @@ chainbase::database_guard& tags_api::guard() const
 tags_api::tags_api(const app::api_context& ctx)
     : _impl(new tags_api_impl(*ctx.app.chain_database()))
     , _guard(ctx.app.chain_database())
+    , _cache(ctx.app.get_api_response_cache())
 {
 }
 
@@ -60,7 +61,11 @@ std::vector<discussion> tags_api::get_discussions_by_trending(const discussion_q
 {
     try
     {
-        return guard().with_read_lock([&]() { return _impl->get_discussions_by_trending(query); });
+        return _cache.get(TAGS_API_NAME, "get_discussions_by_trending",
+                          [&]() {
+                              return guard().with_read_lock([&]() { return _impl->get_discussions_by_trending(query); });
+                          },
+                          query);
     }
     FC_CAPTURE_AND_RETHROW((query))
 }
@@ -69,7 +74,11 @@ std::vector<discussion> tags_api::get_discussions_by_created(const discussion_qu
 {
     try
     {
-        return guard().with_read_lock([&]() { return _impl->get_discussions_by_created(query); });
+        return _cache.get(TAGS_API_NAME, "get_discussions_by_created",
+                          [&]() {
+                              return guard().with_read_lock([&]() { return _impl->get_discussions_by_created(query); });
+                          },
+                          query);
     }
     FC_CAPTURE_AND_RETHROW((query))
 }
@@ -78,7 +87,11 @@ std::vector<discussion> tags_api::get_discussions_by_hot(const discussion_query&
 {
     try
     {
-        return guard().with_read_lock([&]() { return _impl->get_discussions_by_hot(query); });
+        return _cache.get(TAGS_API_NAME, "get_discussions_by_hot",
+                          [&]() {
+                              return guard().with_read_lock([&]() { return _impl->get_discussions_by_hot(query); });
+                          },
+                          query);
     }
     FC_CAPTURE_AND_RETHROW((query))
 }
@@ -91,10 +91,15 @@ private:
     block_production_condition::block_production_condition_enum
     maybe_produce_block(fc::mutable_variant_object& capture);
 
+    void schedule_preassembly_loop();
+    void block_preassembly_loop();
+    void maybe_prepare_block();
+
     boost::program_options::variables_map _options;
     bool _production_enabled = false;
     uint32_t _required_witness_participation = 33 * SCORUM_1_PERCENT;
     uint32_t _production_skip_flags = scorum::chain::database::skip_nothing;
+    uint32_t _block_preassembly_interval_ms = 250;
 
     block_id_type _head_block_id = block_id_type();
     fc::time_point _hash_start_time;
@@ -102,6 +107,10 @@ private:
     std::map<public_key_type, fc::ecc::private_key> _private_keys;
     std::set<std::string> _witnesses;
     fc::future<void> _block_production_task;
+    fc::future<void> _block_preassembly_task;
+
+    fc::time_point_sec _block_candidate_time;
+    fc::time_point _block_candidate_ready_time;
 
     friend class detail::witness_plugin_impl;
     std::unique_ptr<detail::witness_plugin_impl> _my;
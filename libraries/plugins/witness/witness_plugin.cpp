@@ -384,6 +384,10 @@ witness_plugin::~witness_plugin()
         {
             _block_production_task.cancel_and_wait(__FUNCTION__);
         }
+        if (_block_preassembly_task.valid())
+        {
+            _block_preassembly_task.cancel_and_wait(__FUNCTION__);
+        }
     }
     catch (fc::canceled_exception&)
     {
@@ -412,7 +416,11 @@ void witness_plugin::plugin_set_program_options(boost::program_options::options_
         ("name of witness controlled by this node (e.g. " + witness_id_example + " )").c_str())
     ("private-key",
         bpo::value<std::vector<std::string>>()->composing()->multitoken(),
-        "WIF PRIVATE KEY to be used by one or more witnesses or miners");
+        "WIF PRIVATE KEY to be used by one or more witnesses or miners")
+    ("block-preassembly-interval-ms",
+        bpo::value<uint32_t>()->default_value(250)->notifier([this](uint32_t ms) { _block_preassembly_interval_ms = ms; }),
+        "How often to rebuild transactions of our next block ahead of the slot while pending transactions arrive "
+        "(0 disables pre-assembly)");
 
     // clang-format on
     config_file_options.add(command_line_options);
@@ -471,6 +479,11 @@ void witness_plugin::plugin_startup()
                 _production_skip_flags |= scorum::chain::database::skip_undo_history_check;
             }
             schedule_production_loop();
+
+            if (_block_preassembly_interval_ms > 0)
+            {
+                schedule_preassembly_loop();
+            }
         }
         else
         {
@@ -541,7 +554,8 @@ void witness_plugin::block_production_loop()
     switch (result)
     {
     case block_production_condition::produced:
-        ilog("Generated block #${n} with timestamp ${t} at time ${c} by ${w}", (capture));
+        ilog("Generated block #${n} with timestamp ${t} at time ${c} by ${w}, ready ${r}ms before the slot (${a})",
+             (capture));
         break;
     case block_production_condition::not_synced:
         // ilog("Not producing block because production is disabled until we receive a recent block (see:
@@ -663,9 +677,15 @@ witness_plugin::maybe_produce_block(fc::mutable_variant_object& capture)
     {
         try
         {
+            bool preassembled = db.has_block_candidate(scheduled_time) && _block_candidate_time == scheduled_time;
+
             auto block
                 = db.generate_block(scheduled_time, scheduled_witness, private_key_itr->second, _production_skip_flags);
+
+            fc::time_point ready_time = preassembled ? _block_candidate_ready_time : fc::time_point::now();
             capture("n", block.block_num())("t", block.timestamp)("c", now)("w", scheduled_witness);
+            capture("r", (fc::time_point(scheduled_time) - ready_time).count() / 1000)(
+                "a", preassembled ? "pre-assembled" : "assembled in slot");
             fc::async([this, block]() { p2p_node().broadcast(graphene::net::block_message(block)); });
 
             return block_production_condition::produced;
@@ -681,6 +701,72 @@ witness_plugin::maybe_produce_block(fc::mutable_variant_object& capture)
 
     return block_production_condition::exception_producing_block;
 }
+
+void witness_plugin::schedule_preassembly_loop()
+{
+    fc::time_point next_wakeup = fc::time_point::now() + fc::milliseconds(_block_preassembly_interval_ms);
+
+    _block_preassembly_task
+        = fc::schedule([this] { block_preassembly_loop(); }, next_wakeup, "Witness Block Pre-assembly");
+}
+
+void witness_plugin::block_preassembly_loop()
+{
+    try
+    {
+        maybe_prepare_block();
+    }
+    catch (const fc::canceled_exception&)
+    {
+        throw;
+    }
+    catch (const fc::exception& e)
+    {
+        // production falls back to assembling the block in the slot
+        wlog("Got exception while pre-assembling block:\n${e}", ("e", e.to_detail_string()));
+    }
+
+    schedule_preassembly_loop();
+}
+
+void witness_plugin::maybe_prepare_block()
+{
+    if (!_production_enabled)
+        return;
+
+    chain::database& db = database();
+    fc::time_point now = fc::time_point::now();
+
+    uint32_t slot = db.get_slot_at_time(now + fc::seconds(SCORUM_BLOCK_INTERVAL));
+    if (slot == 0)
+        return;
+
+    // production loop wakes up on the second tick and takes slots up to 500ms ahead,
+    // leave the last moments before the slot to it
+    fc::time_point_sec scheduled_time = db.get_slot_time(slot);
+    if (fc::time_point(scheduled_time) - now < fc::milliseconds(600))
+        return;
+
+    std::string scheduled_witness = db.get_scheduled_witness(slot);
+    if (_witnesses.find(scheduled_witness) == _witnesses.end())
+        return;
+
+    if (db.is_block_candidate_actual(scheduled_time))
+        return;
+
+    const auto& witness_by_name = db.get_index<chain::witness_index>().indices().get<chain::by_name>();
+    auto itr = witness_by_name.find(scheduled_witness);
+    if (itr == witness_by_name.end() || _private_keys.find(itr->signing_key) == _private_keys.end())
+        return;
+
+    db.prepare_block_candidate(scheduled_time, _production_skip_flags);
+
+    _block_candidate_time = scheduled_time;
+    _block_candidate_ready_time = fc::time_point::now();
+
+    dlog("Pre-assembled block for slot ${t} in ${d} us",
+         ("t", scheduled_time)("d", (_block_candidate_ready_time - now).count()));
+}
 }
 } // scorum::witness
 
@@ -1609,6 +1609,21 @@ public:
      */
     std::vector<game_api_object> get_games_by_status(const fc::flat_set<game_status>& filter) const;
 
+    /**
+     * @brief Returns games with the status which start within the time window
+     * @param status game status
+     * @param start_from lower bound of the game start time
+     * @param start_to upper bound of the game start time
+     * @param from lower bound game id among games starting at start_from
+     * @param limit query limit
+     * @return array of game_api_object's
+     */
+    std::vector<game_api_object> lookup_games_by_status(game_status status,
+                                                        time_point_sec start_from,
+                                                        time_point_sec start_to,
+                                                        game_id_type from,
+                                                        uint32_t limit) const;
+
     /**
      * @brief Returns games
      * @param uuids UUIDs of games to return
@@ -1654,6 +1669,26 @@ public:
      */
     std::vector<pending_bet_api_object> get_pending_bets(const std::vector<uuid_type>& uuids) const;
 
+    /**
+     * @brief Returns matched bets of an account across all games
+     * @param better account name
+     * @param from lower bound bet id
+     * @param limit query limit
+     * @return array of matched_bet_api_object's
+     */
+    std::vector<matched_bet_api_object>
+    get_account_matched_bets(const std::string& better, matched_bet_id_type from, int64_t limit) const;
+
+    /**
+     * @brief Returns pending bets of an account across all games
+     * @param better account name
+     * @param from lower bound bet id
+     * @param limit query limit
+     * @return array of pending_bet_api_object's
+     */
+    std::vector<pending_bet_api_object>
+    get_account_pending_bets(const std::string& better, pending_bet_id_type from, int64_t limit) const;
+
     /** @}*/
 
 public:
@@ -1828,12 +1863,15 @@ FC_API( scorum::wallet::wallet_api,
         (cancel_pending_bets)
 
         (get_games_by_status)
+        (lookup_games_by_status)
         (get_games_by_uuids)
         (lookup_games_by_id)
         (lookup_matched_bets)
         (lookup_pending_bets)
         (get_matched_bets)
         (get_pending_bets)
+        (get_account_matched_bets)
+        (get_account_pending_bets)
 
         // helper api
         (get_prototype_operation)
@@ -10,6 +10,7 @@
 #include <scorum/wallet/reflect_util.hpp>
 
 #include <scorum/account_by_key/account_by_key_api.hpp>
+#include <scorum/account_bets/account_bets_api.hpp>
 #include <scorum/blockchain_history/account_history_api.hpp>
 #include <scorum/blockchain_history/blockchain_history_api.hpp>
 #include <scorum/blockchain_history/devcommittee_history_api.hpp>
@@ -914,6 +915,23 @@ public:
         }
     }
 
+    void use_remote_account_bets_api()
+    {
+        if (_remote_account_bets_api.valid())
+            return;
+
+        try
+        {
+            _remote_account_bets_api
+                = _remote_api->get_api_by_name(API_ACCOUNT_BETS)->as<account_bets::account_bets_api>();
+        }
+        catch (const fc::exception& e)
+        {
+            elog("Couldn't get account_bets_api");
+            throw(e);
+        }
+    }
+
     void use_remote_account_history_api()
     {
         if (_remote_account_history_api.valid())
@@ -1011,6 +1029,7 @@ public:
     fc::api<network_broadcast_api> _remote_net_broadcast;
     optional<fc::api<network_node_api>> _remote_net_node;
     optional<fc::api<account_by_key::account_by_key_api>> _remote_account_by_key_api;
+    optional<fc::api<account_bets::account_bets_api>> _remote_account_bets_api;
     optional<fc::api<blockchain_history::account_history_api>> _remote_account_history_api;
     optional<fc::api<blockchain_history::blockchain_history_api>> _remote_blockchain_history_api;
     optional<fc::api<blockchain_history::devcommittee_history_api>> _remote_devcommittee_history_api;
@@ -3365,6 +3384,17 @@ std::vector<game_api_object> wallet_api::get_games_by_status(const fc::flat_set<
     return api->get_games_by_status(filter);
 }
 
+std::vector<game_api_object> wallet_api::lookup_games_by_status(game_status status,
+                                                                time_point_sec start_from,
+                                                                time_point_sec start_to,
+                                                                game_id_type from,
+                                                                uint32_t limit) const
+{
+    auto api = my->_remote_api->get_api_by_name(API_BETTING)->as<betting_api>();
+
+    return api->lookup_games_by_status(status, start_from, start_to, from, limit);
+}
+
 std::vector<game_api_object> wallet_api::get_games_by_uuids(const std::vector<uuid_type>& uuids) const
 {
     auto api = my->_remote_api->get_api_by_name(API_BETTING)->as<betting_api>();
@@ -3407,5 +3437,21 @@ std::vector<pending_bet_api_object> wallet_api::get_pending_bets(const std::vect
     return api->get_pending_bets(uuids);
 }
 
+std::vector<matched_bet_api_object>
+wallet_api::get_account_matched_bets(const std::string& better, matched_bet_id_type from, int64_t limit) const
+{
+    my->use_remote_account_bets_api();
+
+    return (*my->_remote_account_bets_api)->get_account_matched_bets(better, from, limit);
+}
+
+std::vector<pending_bet_api_object>
+wallet_api::get_account_pending_bets(const std::string& better, pending_bet_id_type from, int64_t limit) const
+{
+    my->use_remote_account_bets_api();
+
+    return (*my->_remote_account_bets_api)->get_account_pending_bets(better, from, limit);
+}
+
 } // namespace wallet
 } // namespace scorum
@@ -328,6 +328,7 @@ struct expired_contract_refund_visitor
     database& _db;
 
     std::map<account_name_type, asset> refund_map;
+    std::vector<account_name_type> refund_order;
 
     expired_contract_refund_visitor(database& db)
         : _db(db)
@@ -337,6 +338,7 @@ struct expired_contract_refund_visitor
     void operator()(const expired_contract_refund_operation& op)
     {
         refund_map.insert(std::make_pair(op.owner, op.refund));
+        refund_order.push_back(op.owner);
     }
 
     template <typename Op> void operator()(Op&&) const
@@ -380,6 +382,22 @@ SCORUM_TEST_CASE(check_expired_contracts_refund)
     BOOST_REQUIRE_THROW(atomicswap_service.get_contract(bob, alice, alice_secret_hash), fc::exception);
 }
 
+SCORUM_TEST_CASE(expired_contracts_are_refunded_in_owner_order)
+{
+    BOOST_REQUIRE_NO_THROW(push_operations(m_alice_private_key, false, initiate_op, participate_op));
+
+    expired_contract_refund_visitor visitor(db);
+    db.post_apply_operation.connect([&](const operation_notification& note) { note.op.visit(visitor); });
+
+    // both contracts expire in one block, the participant contract of bob has the earlier deadline
+    BOOST_REQUIRE_LT(SCORUM_ATOMICSWAP_PARTICIPANT_REFUND_LOCK_SECS, SCORUM_ATOMICSWAP_INITIATOR_REFUND_LOCK_SECS);
+    BOOST_REQUIRE_EQUAL(generate_blocks(db.head_block_time() + SCORUM_ATOMICSWAP_INITIATOR_REFUND_LOCK_SECS), 1u);
+
+    std::vector<account_name_type> expected = { "alice", "bob" };
+    BOOST_CHECK_EQUAL_COLLECTIONS(visitor.refund_order.begin(), visitor.refund_order.end(), expected.begin(),
+                                  expected.end());
+}
+
 SCORUM_TEST_CASE(check_redeemed_expired_contracts)
 {
     const account_object& alice = account_service.get_account("alice");
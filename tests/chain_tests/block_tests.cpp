@@ -37,6 +37,7 @@
 #include <graphene/utilities/tempdir.hpp>
 
 #include <fc/crypto/digest.hpp>
+#include <fc/io/json.hpp>
 
 #include "database_default_integration.hpp"
 #include "database_integration.hpp"
@@ -396,6 +397,179 @@ BOOST_AUTO_TEST_CASE(duplicate_transactions)
     }
 }
 
+BOOST_AUTO_TEST_CASE(generate_block_from_candidate)
+{
+    try
+    {
+        fc::temp_directory dir(graphene::utilities::temp_directory_path());
+
+        database db(database::opt_default);
+        db_setup_and_open(db, dir.path());
+
+        auto skip_sigs = database::skip_transaction_signatures | database::skip_authority_check;
+
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+        public_key_type init_account_pub_key = init_account_priv_key.get_public_key();
+
+        signed_transaction create_trx;
+        account_create_operation cop;
+        cop.new_account_name = "alice";
+        cop.creator = TEST_INIT_DELEGATE_NAME;
+        cop.owner = authority(1, init_account_pub_key, 1);
+        cop.fee = SUFFICIENT_FEE;
+        cop.active = cop.owner;
+        create_trx.operations.push_back(cop);
+        create_trx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        create_trx.sign(init_account_priv_key, db.get_chain_id());
+        PUSH_TX(db, create_trx, skip_sigs);
+
+        auto slot_time = db.get_slot_time(1);
+
+        db.prepare_block_candidate(slot_time, skip_sigs);
+
+        BOOST_CHECK(db.is_block_candidate_actual(slot_time));
+        BOOST_CHECK(!db.has_block_candidate(db.get_slot_time(2)));
+
+        // pending state is rebuilt after pre-assembly
+        BOOST_CHECK_NO_THROW(db.account_service().get_account("alice"));
+
+        signed_transaction transfer_trx;
+        transfer_operation t;
+        t.from = TEST_INIT_DELEGATE_NAME;
+        t.to = "alice";
+        t.amount = asset(500, SCORUM_SYMBOL);
+        transfer_trx.operations.push_back(t);
+        transfer_trx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        transfer_trx.sign(init_account_priv_key, db.get_chain_id());
+        PUSH_TX(db, transfer_trx, skip_sigs);
+
+        BOOST_CHECK(db.has_block_candidate(slot_time));
+        BOOST_CHECK(!db.is_block_candidate_actual(slot_time));
+
+        auto b = db.generate_block(slot_time, db.get_scheduled_witness(1), init_account_priv_key, skip_sigs);
+
+        BOOST_REQUIRE_EQUAL(b.transactions.size(), 1u);
+        BOOST_CHECK(b.transactions[0].id() == create_trx.id());
+        BOOST_CHECK(!db.has_block_candidate(slot_time));
+
+        // transaction which arrived after pre-assembly goes to the next block
+        b = db.generate_block(db.get_slot_time(1), db.get_scheduled_witness(1), init_account_priv_key, skip_sigs);
+
+        BOOST_REQUIRE_EQUAL(b.transactions.size(), 1u);
+        BOOST_CHECK(b.transactions[0].id() == transfer_trx.id());
+        BOOST_CHECK_EQUAL(db.account_service().get_account("alice").balance.amount, 500);
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(parallel_signature_recovery_keeps_state)
+{
+    try
+    {
+        fc::temp_directory dir1(graphene::utilities::temp_directory_path());
+        fc::temp_directory dir2(graphene::utilities::temp_directory_path());
+        fc::temp_directory dir3(graphene::utilities::temp_directory_path());
+
+        database producer(database::opt_default);
+        db_setup_and_open(producer, dir1.path());
+        database serial(database::opt_default);
+        db_setup_and_open(serial, dir2.path());
+        database parallel(database::opt_default);
+        db_setup_and_open(parallel, dir3.path());
+
+        serial.set_signature_recovery_threads(1);
+        parallel.set_signature_recovery_threads(4);
+
+        auto init_account_priv_key = fc::ecc::private_key::regenerate(fc::sha256::hash(std::string(TEST_INIT_KEY)));
+        public_key_type init_account_pub_key = init_account_priv_key.get_public_key();
+
+        std::vector<signed_block> blocks;
+        auto generate = [&]() {
+            blocks.push_back(producer.generate_block(producer.get_slot_time(1), producer.get_scheduled_witness(1),
+                                                     init_account_priv_key, database::skip_nothing));
+        };
+
+        const std::vector<std::string> names = { "alice", "bob", "carol", "dave", "eve", "frank" };
+        for (const auto& name : names)
+        {
+            signed_transaction trx;
+            account_create_operation cop;
+            cop.new_account_name = name;
+            cop.creator = TEST_INIT_DELEGATE_NAME;
+            cop.owner = authority(1, init_account_pub_key, 1);
+            cop.fee = SUFFICIENT_FEE;
+            cop.active = cop.owner;
+            trx.operations.push_back(cop);
+
+            transfer_operation t;
+            t.from = TEST_INIT_DELEGATE_NAME;
+            t.to = name;
+            t.amount = asset(1000, SCORUM_SYMBOL);
+            trx.operations.push_back(t);
+
+            trx.set_expiration(producer.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+            trx.sign(init_account_priv_key, producer.get_chain_id());
+            PUSH_TX(producer, trx);
+        }
+        generate();
+
+        // transfers between disjoint pairs of accounts as well as chains of transfers touching the same accounts
+        for (int bi = 0; bi < 5; ++bi)
+        {
+            for (size_t i = 0; i < names.size(); ++i)
+            {
+                signed_transaction trx;
+                transfer_operation t;
+                t.from = names[i];
+                t.to = names[(i + 1 + bi) % names.size()];
+                t.amount = asset(10 + bi, SCORUM_SYMBOL);
+                t.memo = std::to_string(bi);
+                trx.operations.push_back(t);
+                trx.set_expiration(producer.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+                trx.sign(init_account_priv_key, producer.get_chain_id());
+                PUSH_TX(producer, trx);
+            }
+            generate();
+        }
+
+        for (const auto& b : blocks)
+        {
+            PUSH_BLOCK(serial, b, database::skip_nothing);
+            PUSH_BLOCK(parallel, b, database::skip_nothing);
+        }
+
+        BOOST_CHECK(serial.head_block_id() == producer.head_block_id());
+        BOOST_CHECK(parallel.head_block_id() == producer.head_block_id());
+
+        auto state = [](database& db) {
+            std::vector<std::string> result;
+            for (const auto& account : db.get_index<account_index>().indices().get<by_name>())
+                result.push_back(fc::json::to_string(account));
+            result.push_back(fc::json::to_string(db.dynamic_global_property_service().get()));
+            return result;
+        };
+
+        auto serial_state = state(serial);
+        auto parallel_state = state(parallel);
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(serial_state.begin(), serial_state.end(), parallel_state.begin(),
+                                      parallel_state.end());
+
+        BOOST_CHECK_EQUAL(serial.get_signature_cache().get_stats().prefetched, 0u);
+        BOOST_CHECK_EQUAL(parallel.get_signature_cache().get_stats().prefetched, names.size() * 6);
+        BOOST_CHECK_EQUAL(parallel.get_signature_cache().get_stats().misses, 0u);
+    }
+    catch (fc::exception& e)
+    {
+        edump((e.to_detail_string()));
+        throw;
+    }
+}
+
 BOOST_AUTO_TEST_CASE(tapos)
 {
     try
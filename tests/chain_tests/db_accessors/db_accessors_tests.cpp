@@ -10,6 +10,7 @@
 #include "database_default_integration.hpp"
 
 #include <boost/range/adaptor/reversed.hpp>
+#include <boost/range/size.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 namespace {
@@ -113,5 +114,36 @@ BOOST_AUTO_TEST_CASE(get_range_by_bounds_tests)
     // but 'do not include'/'include' the boundaries
 }
 
+BOOST_AUTO_TEST_CASE(get_index_range_by_should_select_same_objects_as_get_range_by)
+{
+    db_accessor_factory dba_factory{ static_cast<dba::db_index&>(db) };
+    db_accessor<comment_object>& dba = dba_factory.get_dba<comment_object>();
+
+    // clang-format off
+    dba.create([&](comment_object& o) { o.author = "test_0"; fc::from_string(o.permlink, "pl_0"); });
+    dba.create([&](comment_object& o) { o.author = "test_1"; fc::from_string(o.permlink, "pl_1"); });
+    dba.create([&](comment_object& o) { o.author = "test_1"; fc::from_string(o.permlink, "pl_2"); });
+    dba.create([&](comment_object& o) { o.author = "test_2"; fc::from_string(o.permlink, "pl_3"); });
+    dba.create([&](comment_object& o) { o.author = "test_3"; fc::from_string(o.permlink, "pl_4"); });
+    // clang-format on
+
+    auto check = [](const auto& typed, utils::bidir_range<const comment_object> erased) {
+        BOOST_REQUIRE_EQUAL(boost::size(typed), (size_t)std::distance(erased.begin(), erased.end()));
+        BOOST_CHECK(std::equal(typed.begin(), typed.end(), erased.begin(),
+                               [](const comment_object& l, const comment_object& r) { return &l == &r; }));
+    };
+
+    check(dba.get_index_range_by<by_permlink>("test_1"s), dba.get_range_by<by_permlink>("test_1"s));
+    check(dba.get_index_range_by<by_permlink>("test_1"s < _x, _x <= "test_3"s),
+          dba.get_range_by<by_permlink>("test_1"s < _x, _x <= "test_3"s));
+    check(dba.get_index_range_by<by_permlink>("test_1"s <= _x, dba::unbounded),
+          dba.get_range_by<by_permlink>("test_1"s <= _x, dba::unbounded));
+    check(dba.get_index_range_by<by_permlink>(dba::unbounded, _x < "test_2"s),
+          dba.get_range_by<by_permlink>(dba::unbounded, _x < "test_2"s));
+    check(dba.get_index_range_by<by_permlink>(dba::unbounded, dba::unbounded),
+          dba.get_range_by<by_permlink>(dba::unbounded, dba::unbounded));
+    check(dba.get_index_all_by<by_id>(), dba.get_all_by<by_id>());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }
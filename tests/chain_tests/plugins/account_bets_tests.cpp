@@ -0,0 +1,112 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_context.hpp>
+
+#include <scorum/account_bets/account_bets_plugin.hpp>
+#include <scorum/account_bets/account_bets_api.hpp>
+#include <scorum/account_bets/account_bets_objects.hpp>
+
+#include <scorum/chain/schema/betting_property_object.hpp>
+#include <scorum/chain/dba/db_accessor.hpp>
+
+#include <scorum/common_api/config_api.hpp>
+
+#include "defines.hpp"
+#include "detail.hpp"
+
+#include "database_betting_integration.hpp"
+#include "actor.hpp"
+
+namespace {
+
+using namespace scorum::protocol;
+using namespace scorum::chain;
+using namespace scorum::app;
+using namespace database_fixture;
+
+struct account_bets_fixture : public database_fixture::database_betting_integration_fixture
+{
+    account_bets_fixture()
+        : _api_ctx(app, API_ACCOUNT_BETS, std::make_shared<api_session_data>())
+        , _api(_api_ctx)
+        , betting_prop_dba(db)
+    {
+        init_plugin<scorum::account_bets::account_bets_plugin>();
+
+        open_database();
+
+        alice.scorum(ASSET_SCR(1e+9));
+        actor(initdelegate).create_account(alice);
+        actor(initdelegate).give_sp(alice, 1e+9);
+        actor(initdelegate).give_scr(alice, alice.scr_amount.amount.value);
+
+        bob.scorum(ASSET_SCR(1e+9));
+        actor(initdelegate).create_account(bob);
+        actor(initdelegate).give_sp(bob, 1e+9);
+        actor(initdelegate).give_scr(bob, bob.scr_amount.amount.value);
+
+        actor(initdelegate).create_account(moderator);
+        actor(initdelegate).give_sp(moderator, 1e+9);
+        actor(initdelegate).give_scr(moderator, 1e+9);
+
+        empower_moderator(moderator);
+    }
+
+    size_t tracked_bets_count() const
+    {
+        return db.get_index<scorum::account_bets::account_bet_index>().indices().size();
+    }
+
+    Actor alice = "alice";
+    Actor bob = "bob";
+    Actor moderator = "smit";
+
+    api_context _api_ctx;
+    scorum::account_bets::account_bets_api _api;
+
+    dba::db_accessor<betting_property_object> betting_prop_dba;
+};
+
+BOOST_FIXTURE_TEST_SUITE(account_bets_tests, account_bets_fixture)
+
+SCORUM_TEST_CASE(account_bets_should_follow_bets_until_resolving)
+{
+    create_game(moderator, { result_away{}, total{ 2000 } }, SCORUM_BLOCK_INTERVAL * 2);
+    generate_block();
+
+    create_bet(gen_uuid("b1"), alice, result_away::yes{}, { 10, 2 }, alice.scr_amount / 2);
+    create_bet(gen_uuid("b2"), bob, result_away::no{}, { 10, 8 }, bob.scr_amount / 2);
+    generate_block();
+
+    // alice bet is matched partially, bob bet is matched fully
+    auto alice_pending = _api.get_account_pending_bets(alice.name, 0, 100);
+    BOOST_REQUIRE_EQUAL(alice_pending.size(), 1u);
+    BOOST_CHECK(alice_pending[0].data.uuid == gen_uuid("b1"));
+    BOOST_CHECK(_api.get_account_pending_bets(bob.name, 0, 100).empty());
+
+    auto alice_matched = _api.get_account_matched_bets(alice.name, 0, 100);
+    auto bob_matched = _api.get_account_matched_bets(bob.name, 0, 100);
+    BOOST_REQUIRE_EQUAL(alice_matched.size(), 1u);
+    BOOST_REQUIRE_EQUAL(bob_matched.size(), 1u);
+    BOOST_CHECK_EQUAL(alice_matched[0].id._id, bob_matched[0].id._id);
+
+    BOOST_CHECK(_api.get_account_matched_bets(alice.name, alice_matched[0].id._id + 1, 100).empty());
+    BOOST_CHECK_EQUAL(tracked_bets_count(), 3u);
+
+    post_results(moderator, { result_away::no{} });
+    generate_blocks(db.head_block_time() + betting_prop_dba.get().resolve_delay_sec);
+
+    BOOST_CHECK(_api.get_account_pending_bets(alice.name, 0, 100).empty());
+    BOOST_CHECK(_api.get_account_matched_bets(alice.name, 0, 100).empty());
+    BOOST_CHECK(_api.get_account_matched_bets(bob.name, 0, 100).empty());
+    BOOST_CHECK_EQUAL(tracked_bets_count(), 0u);
+}
+
+SCORUM_TEST_CASE(account_bets_limit_should_not_exceed_lookup_limit)
+{
+    BOOST_CHECK_THROW(_api.get_account_pending_bets(alice.name, 0, LOOKUP_LIMIT + 1), fc::assert_exception);
+    BOOST_CHECK_THROW(_api.get_account_matched_bets(alice.name, 0, LOOKUP_LIMIT + 1), fc::assert_exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
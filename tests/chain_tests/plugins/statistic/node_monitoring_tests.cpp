@@ -84,4 +84,22 @@ SCORUM_TEST_CASE(check_free_shared_memory)
     BOOST_REQUIRE_GT(_api_call.get_free_shared_memory_mb(), 0u);
 }
 
+SCORUM_TEST_CASE(check_block_timing_stats)
+{
+    generate_blocks(3);
+
+    auto stats = _api_call.get_block_timing_stats();
+
+    BOOST_REQUIRE(stats.count("phase.apply_block"));
+    BOOST_REQUIRE(stats.count("phase.transactions"));
+    BOOST_REQUIRE(stats.count("task.process_funds"));
+
+    const auto& block = stats["phase.apply_block"];
+    BOOST_CHECK_GE(block.count, 3u);
+    BOOST_CHECK_LE(block.p50, block.p90);
+    BOOST_CHECK_LE(block.p90, block.p99);
+    BOOST_CHECK_LE(block.p99, block.max);
+    BOOST_CHECK_GE(block.max, stats["phase.transactions"].max);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,146 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/account_authority_cache.hpp>
+#include <scorum/protocol/transaction.hpp>
+
+#include "database_trx_integration.hpp"
+
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using namespace database_fixture;
+
+using performance_common::cpu_profiler;
+
+namespace {
+
+/**
+ * Resolves authorities of multisig and nested accounts for the same signed transactions
+ * through account_authority_cache with the cache enabled and disabled.
+ */
+struct authority_cache_benchmark_fixture : public database_trx_integration_fixture
+{
+    authority_cache_benchmark_fixture()
+    {
+        open_database();
+        generate_block();
+
+        for (int i = 0; i < 5; ++i)
+        {
+            Actor member("member" + std::to_string(i));
+            create_account(member.name, authority(1, member.public_key, 1));
+            members.push_back(member);
+        }
+
+        // 3 of 5 keys
+        authority multisig_auth;
+        multisig_auth.weight_threshold = 3;
+        for (const auto& m : members)
+            multisig_auth.add_authority(m.public_key, 1);
+        create_account("multisig", multisig_auth);
+
+        // 2 of 3 member accounts, which are resolved through their own authorities
+        authority board_auth;
+        board_auth.weight_threshold = 2;
+        for (int i = 0; i < 3; ++i)
+            board_auth.add_authority(members[i].name, 1);
+        create_account("board", board_auth);
+
+        // controlled by the board account one level deeper
+        create_account("treasury", authority(1, "board", 1));
+
+        generate_block();
+
+        add_transfer("multisig", { members[0], members[1], members[2] });
+        add_transfer("board", { members[0], members[1] });
+        add_transfer("treasury", { members[1], members[2] });
+    }
+
+    void create_account(const std::string& name, const authority& auth)
+    {
+        account_create_with_delegation_operation op;
+        op.new_account_name = name;
+        op.creator = initdelegate.name;
+        op.fee = asset(get_account_creation_fee(), SCORUM_SYMBOL);
+        op.delegation = asset(0, SP_SYMBOL);
+        op.owner = auth;
+        op.active = auth;
+        op.posting = auth;
+        op.memo_key = initdelegate.public_key;
+
+        push_operation_only(op, initdelegate.private_key);
+    }
+
+    void add_transfer(const std::string& from, const std::vector<Actor>& signers)
+    {
+        transfer_operation op;
+        op.from = from;
+        op.to = initdelegate.name;
+        op.amount = ASSET_SCR(1);
+
+        signed_transaction tx;
+        tx.operations.push_back(op);
+        tx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        for (const auto& s : signers)
+            tx.sign(s.private_key, db.get_chain_id());
+
+        transactions.push_back(tx);
+        // signatures are recovered once, the benchmark is about resolving authorities
+        signature_keys.push_back(tx.get_signature_keys(db.get_chain_id()));
+    }
+
+    size_t verify_all(bool cached, size_t cycles)
+    {
+        account_authority_cache& cache = db.get_account_authority_cache();
+        cache.set_enabled(cached);
+
+        auto get_active = [&](const std::string& name) { return cache.get(db, name).active; };
+        auto get_owner = [&](const std::string& name) { return cache.get(db, name).owner; };
+        auto get_posting = [&](const std::string& name) { return cache.get(db, name).posting; };
+
+        return db.with_read_lock([&]() {
+            cpu_profiler prof;
+
+            for (size_t ci = 0; ci < cycles; ++ci)
+            {
+                for (size_t i = 0; i < transactions.size(); ++i)
+                {
+                    verify_authority(transactions[i].operations, signature_keys[i], get_active, get_owner,
+                                     get_posting, SCORUM_MAX_SIG_CHECK_DEPTH);
+                }
+            }
+
+            return prof.elapsed_microseconds();
+        });
+    }
+
+    std::vector<Actor> members;
+    std::vector<signed_transaction> transactions;
+    std::vector<flat_set<public_key_type>> signature_keys;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(authority_cache_benchmark_tests, authority_cache_benchmark_fixture)
+
+SCORUM_TEST_CASE(multisig_and_nested_authorities_benchmark)
+{
+    const size_t cycles = 20'000;
+
+    // warm up the allocator and the cache itself
+    verify_all(true, 100);
+
+    size_t uncached = verify_all(false, cycles);
+    BOOST_TEST_MESSAGE("authorities resolved from database: " << uncached << "us");
+
+    size_t cached = verify_all(true, cycles);
+    BOOST_TEST_MESSAGE("authorities resolved from cache: " << cached << "us");
+
+    auto& cache = db.get_account_authority_cache();
+    BOOST_TEST_MESSAGE("cache size: " << cache.size() << ", hits: " << cache.hits() << ", misses: " << cache.misses());
+
+    BOOST_CHECK_LT(cached, uncached);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+#include "benchmark_report.hpp"
+
+#include <fc/io/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace performance_common {
+
+benchmark_report::benchmark_report(const std::string& name)
+    : _name(name)
+{
+}
+
+void benchmark_report::add_sample(uint64_t microseconds, uint64_t operations)
+{
+    _samples_us.push_back(microseconds);
+    _total_us += microseconds;
+    _operations += operations;
+}
+
+const std::string& benchmark_report::name() const
+{
+    return _name;
+}
+
+uint64_t benchmark_report::samples() const
+{
+    return _samples_us.size();
+}
+
+uint64_t benchmark_report::operations() const
+{
+    return _operations;
+}
+
+double benchmark_report::samples_per_second() const
+{
+    return _total_us ? _samples_us.size() * 1e6 / _total_us : 0;
+}
+
+double benchmark_report::operations_per_second() const
+{
+    return _total_us ? _operations * 1e6 / _total_us : 0;
+}
+
+uint64_t benchmark_report::percentile(double p) const
+{
+    if (_samples_us.empty())
+        return 0;
+
+    std::vector<uint64_t> sorted(_samples_us);
+    std::sort(sorted.begin(), sorted.end());
+
+    size_t rank = (size_t)std::ceil(p / 100 * sorted.size());
+    return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+}
+
+fc::variant_object benchmark_report::to_variant(const fc::variant_object& parameters) const
+{
+    fc::mutable_variant_object latency;
+    latency["p50"] = percentile(50);
+    latency["p90"] = percentile(90);
+    latency["p99"] = percentile(99);
+    latency["max"] = percentile(100);
+    latency["mean"] = _samples_us.empty() ? 0 : _total_us / _samples_us.size();
+
+    fc::mutable_variant_object result;
+    result["benchmark"] = _name;
+    result["parameters"] = parameters;
+    result["blocks"] = samples();
+    result["operations"] = operations();
+    result["total_us"] = _total_us;
+    result["blocks_per_second"] = samples_per_second();
+    result["ops_per_second"] = operations_per_second();
+    result["block_latency_us"] = latency;
+    return result;
+}
+
+std::vector<std::string> find_regressions(const fc::variant_object& report, const fc::path& baseline_file)
+{
+    std::vector<std::string> regressions;
+
+    if (!fc::exists(baseline_file))
+        return regressions;
+
+    auto baseline = fc::json::from_file(baseline_file).get_object();
+    auto results = baseline["results"].get_object();
+    auto name = report["benchmark"].as_string();
+
+    if (!results.contains(name.c_str()))
+        return regressions;
+
+    double max_regression_percent = baseline["max_regression_percent"].as_double();
+    for (const auto& expected : results[name].get_object())
+    {
+        double minimal = expected.value().as_double() * (100 - max_regression_percent) / 100;
+        double actual = report[expected.key()].as_double();
+        if (actual < minimal)
+        {
+            std::stringstream msg;
+            msg << name << "." << expected.key() << " = " << actual << " is more than " << max_regression_percent
+                << "% below the baseline " << expected.value().as_double();
+            regressions.push_back(msg.str());
+        }
+    }
+
+    return regressions;
+}
+}
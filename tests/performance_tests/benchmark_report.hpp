@@ -0,0 +1,54 @@
+#pragma once
+
+#include <fc/filesystem.hpp>
+#include <fc/variant_object.hpp>
+
+#include <string>
+#include <vector>
+
+namespace performance_common {
+
+/**
+ * Collects per-sample latencies of a benchmark (one sample per applied block, for instance)
+ * and renders them as a JSON-friendly variant with throughput and latency percentiles.
+ */
+class benchmark_report
+{
+public:
+    explicit benchmark_report(const std::string& name);
+
+    void add_sample(uint64_t microseconds, uint64_t operations);
+
+    const std::string& name() const;
+
+    uint64_t samples() const;
+    uint64_t operations() const;
+
+    double samples_per_second() const;
+    double operations_per_second() const;
+
+    // nearest-rank percentile of the sample latencies, in microseconds
+    uint64_t percentile(double p) const;
+
+    fc::variant_object to_variant(const fc::variant_object& parameters) const;
+
+private:
+    std::string _name;
+    std::vector<uint64_t> _samples_us;
+    uint64_t _operations = 0;
+    uint64_t _total_us = 0;
+};
+
+/**
+ * Compares a report produced by benchmark_report::to_variant with a stored baseline:
+ *
+ *   {
+ *     "max_regression_percent": 30,
+ *     "results": { "<benchmark name>": { "<metric>": <minimal value>, ... }, ... }
+ *   }
+ *
+ * Every metric listed for the benchmark is treated as higher-is-better. Returns the list of
+ * metrics which fell more than max_regression_percent below the baseline.
+ */
+std::vector<std::string> find_regressions(const fc::variant_object& report, const fc::path& baseline_file);
+}
@@ -0,0 +1,164 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/betting_event_stream.hpp>
+
+#include <boost/uuid/uuid_generators.hpp>
+
+#include "defines.hpp"
+
+#include "performance_common.hpp"
+
+namespace betting_events_load_tests {
+
+using namespace scorum;
+using namespace scorum::app;
+using namespace scorum::protocol;
+
+using performance_common::cpu_profiler;
+
+/**
+ * Feeds blocks full of betting virtual operations to many subscriptions, like a node serving betting front-ends
+ * over websockets, half of them following games and half following betters.
+ */
+struct betting_events_load_fixture
+{
+    betting_events_load_fixture()
+    {
+        for (size_t i = 0; i < games_count; ++i)
+            games.push_back(uuid_gen("game" + std::to_string(i)));
+
+        for (size_t i = 0; i < ops_per_block; ++i)
+        {
+            const auto& game = games[i % games_count];
+            const std::string better1 = better(i);
+            const std::string better2 = better(i + 1);
+            const std::string suffix = std::to_string(i);
+
+            switch (i % 3)
+            {
+            case 0:
+                ops.push_back(bets_matched_operation(better1, better2, uuid_gen(better1 + suffix),
+                                                     uuid_gen(better2 + suffix), ASSET_SCR(10), ASSET_SCR(10), i));
+                break;
+            case 1:
+                ops.push_back(bet_cancelled_operation(game, better1, uuid_gen(better1 + suffix), ASSET_SCR(10),
+                                                      bet_kind::pending));
+                break;
+            default:
+                ops.push_back(bet_resolved_operation(game, better1, uuid_gen(better1 + suffix), ASSET_SCR(20),
+                                                     bet_resolve_kind::win));
+            }
+        }
+    }
+
+    std::string better(size_t i) const
+    {
+        return "better" + std::to_string(i % betters_count);
+    }
+
+    void subscribe(size_t subscribers, uint32_t queue_limit)
+    {
+        streams.clear();
+        for (size_t i = 0; i < subscribers; ++i)
+        {
+            betting_events_filter filter;
+            if (i % 2)
+                filter.games = { games[i % games_count] };
+            else
+                filter.betters = { better(i) };
+
+            streams.push_back(std::make_shared<betting_event_stream>(
+                [&](const fc::variant& v) {
+                    ++messages;
+                    events += v["events"].get_array().size();
+                },
+                filter, [&](int64_t matched_bet_id) { return games[matched_bet_id % games_count]; }, queue_limit));
+        }
+    }
+
+    size_t apply_blocks(size_t blocks)
+    {
+        cpu_profiler prof;
+
+        for (size_t bi = 0; bi < blocks; ++bi)
+        {
+            signed_block block;
+
+            for (auto& stream : streams)
+                stream->on_pre_applied_block(block);
+
+            for (const auto& op : ops)
+            {
+                chain::operation_notification note(transaction_id_type(), bi, 0, 0, op);
+                for (auto& stream : streams)
+                    stream->on_operation(note);
+            }
+
+            for (auto& stream : streams)
+                stream->on_applied_block(block);
+        }
+
+        return prof.elapsed();
+    }
+
+    uuid_type uuid_ns = boost::uuids::string_generator()("e629f9aa-6b2c-46aa-8fa8-36770e7a7a5f");
+    boost::uuids::name_generator uuid_gen = boost::uuids::name_generator(uuid_ns);
+
+    const size_t games_count = 100;
+    const size_t betters_count = 1'000;
+    const size_t ops_per_block = 3'000;
+
+    std::vector<uuid_type> games;
+    std::vector<operation> ops;
+
+    std::vector<std::shared_ptr<betting_event_stream>> streams;
+    size_t messages = 0;
+    size_t events = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(betting_events_load_tests, betting_events_load_fixture)
+
+SCORUM_TEST_CASE(many_subscribers_load_test)
+{
+    const size_t blocks = 10;
+
+    for (size_t subscribers : { 100u, 1'000u, 5'000u })
+    {
+        messages = 0;
+        events = 0;
+
+        subscribe(subscribers, BETTING_EVENTS_QUEUE_LIMIT);
+
+        size_t elapsed = apply_blocks(blocks);
+
+        BOOST_TEST_MESSAGE(subscribers << " subscribers, " << blocks << " blocks of " << ops_per_block
+                                       << " betting operations: " << elapsed << "ms, " << messages << " messages, "
+                                       << events << " events");
+
+        // every subscriber follows something which happens in every block
+        BOOST_CHECK_EQUAL(messages, subscribers * blocks);
+    }
+}
+
+SCORUM_TEST_CASE(queue_limit_bounds_message_size)
+{
+    const uint32_t queue_limit = 10;
+
+    // followers of all events get the busiest messages
+    streams.clear();
+    streams.push_back(std::make_shared<betting_event_stream>(
+        [&](const fc::variant& v) {
+            ++messages;
+            events += v["events"].get_array().size();
+            BOOST_CHECK_EQUAL(v["dropped"].as_uint64(), ops_per_block - queue_limit);
+        },
+        betting_events_filter(), [&](int64_t) { return games[0]; }, queue_limit));
+
+    apply_blocks(5);
+
+    BOOST_CHECK_EQUAL(messages, 5u);
+    BOOST_CHECK_EQUAL(events, 5u * queue_limit);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
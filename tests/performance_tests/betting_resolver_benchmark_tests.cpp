@@ -0,0 +1,168 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/betting/betting_resolver.hpp>
+#include <scorum/chain/dba/db_accessor.hpp>
+#include <scorum/chain/schema/bet_objects.hpp>
+#include <scorum/chain/schema/game_object.hpp>
+#include <scorum/chain/services/account.hpp>
+
+#include "database_trx_integration.hpp"
+#include "detail.hpp"
+
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using namespace database_fixture;
+
+using performance_common::cpu_profiler;
+
+namespace {
+
+/**
+ * Resolves a game with many matched bets inside a block, once with the per-bet payouts resolve_matched_bets
+ * used to do (one balance modify per bet and one global property update per bet) and once with betting_resolver.
+ */
+struct betting_resolver_benchmark_fixture : public database_trx_integration_fixture
+{
+    betting_resolver_benchmark_fixture()
+    {
+        open_database();
+        generate_block();
+
+        db_plugin->debug_update(
+            [&](database&) {
+                for (size_t i = 0; i < betters_count; ++i)
+                {
+                    db.create<account_object>([&](account_object& o) { o.name = better(i); });
+                }
+            },
+            get_skip_flags());
+    }
+
+    static std::string better(size_t i)
+    {
+        return "better" + std::to_string(i);
+    }
+
+    void create_matched_bets(const uuid_type& game_uuid, size_t count)
+    {
+        auto& matched_bet_dba = db.get_dba<matched_bet_object>();
+        auto& dprop_dba = db.get_dba<dynamic_global_property_object>();
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            matched_bet_dba.create([&](matched_bet_object& o) {
+                o.game_uuid = game_uuid;
+                o.market = result_home{};
+                o.bet1_data.better = better(i % betters_count);
+                o.bet1_data.stake = ASSET_SCR(10);
+                o.bet1_data.wincase = result_home::yes{};
+                o.bet2_data.better = better((i * 7 + 1) % betters_count);
+                o.bet2_data.stake = ASSET_SCR(20);
+                // every third bet is a draw for both sides
+                if (i % 3)
+                    o.bet2_data.wincase = result_home::no{};
+                else
+                    o.bet2_data.wincase = result_home::yes{};
+            });
+        }
+
+        dprop_dba.update([&](dynamic_global_property_object& o) {
+            o.betting_stats.matched_bets_volume += ASSET_SCR(30 * static_cast<int64_t>(count));
+        });
+    }
+
+    void resolve_per_bet(const uuid_type& game_uuid, const fc::flat_set<wincase_type>& results)
+    {
+        auto& account_svc = db.account_service();
+        auto& matched_bet_dba = db.get_dba<matched_bet_object>();
+        auto& dprop_dba = db.get_dba<dynamic_global_property_object>();
+
+        auto matched_bets = matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid);
+
+        for (const matched_bet_object& bet : matched_bets)
+        {
+            auto fst_won = results.find(bet.bet1_data.wincase) != results.end();
+            auto snd_won = results.find(bet.bet2_data.wincase) != results.end();
+
+            auto income = bet.bet1_data.stake + bet.bet2_data.stake;
+
+            if (fst_won)
+            {
+                account_svc.increase_balance(bet.bet1_data.better, income);
+                db.push_virtual_operation(bet_resolved_operation(game_uuid, bet.bet1_data.better, bet.bet1_data.uuid,
+                                                                 income, bet_resolve_kind::win));
+            }
+            else if (snd_won)
+            {
+                account_svc.increase_balance(bet.bet2_data.better, income);
+                db.push_virtual_operation(bet_resolved_operation(game_uuid, bet.bet2_data.better, bet.bet2_data.uuid,
+                                                                 income, bet_resolve_kind::win));
+            }
+            else
+            {
+                account_svc.increase_balance(bet.bet1_data.better, bet.bet1_data.stake);
+                account_svc.increase_balance(bet.bet2_data.better, bet.bet2_data.stake);
+                db.push_virtual_operation(bet_resolved_operation(game_uuid, bet.bet1_data.better, bet.bet1_data.uuid,
+                                                                 bet.bet1_data.stake, bet_resolve_kind::draw));
+                db.push_virtual_operation(bet_resolved_operation(game_uuid, bet.bet1_data.better, bet.bet1_data.uuid,
+                                                                 bet.bet1_data.stake, bet_resolve_kind::draw));
+            }
+
+            dprop_dba.update([&](dynamic_global_property_object& o) { o.betting_stats.matched_bets_volume -= income; });
+        }
+
+        matched_bet_dba.remove_all(matched_bets);
+    }
+
+    template <typename Resolve> size_t measure(size_t bets_count, Resolve&& resolve)
+    {
+        size_t elapsed = 0;
+
+        uuid_type game_uuid = gen_uuid("game" + std::to_string(bets_count) + std::to_string(++_games));
+
+        // the bets are created and resolved in the same block, so balance changes make undo copies as in production
+        db_plugin->debug_update(
+            [&](database&) {
+                create_matched_bets(game_uuid, bets_count);
+
+                cpu_profiler prof;
+
+                resolve(game_uuid, fc::flat_set<wincase_type>{ result_home::yes{} });
+
+                elapsed = prof.elapsed_microseconds();
+            },
+            get_skip_flags());
+
+        return elapsed;
+    }
+
+    const size_t betters_count = 1'000;
+
+    size_t _games = 0;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(betting_resolver_benchmark_tests, betting_resolver_benchmark_fixture)
+
+SCORUM_TEST_CASE(resolve_matched_bets_benchmark)
+{
+    betting_resolver resolver(db.account_service(), db, db.get_dba<matched_bet_object>(), db.get_dba<game_object>(),
+                              db.get_dba<dynamic_global_property_object>());
+
+    for (size_t count : { 10'000u, 50'000u, 100'000u })
+    {
+        size_t per_bet
+            = measure(count, [&](const uuid_type& uuid, const auto& results) { resolve_per_bet(uuid, results); });
+
+        size_t batched = measure(
+            count, [&](const uuid_type& uuid, const auto& results) { resolver.resolve_matched_bets(uuid, results); });
+
+        BOOST_TEST_MESSAGE(count << " matched bets: per bet payouts " << per_bet << "us, batched payouts " << batched
+                                 << "us");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,403 @@
+#include <boost/test/unit_test.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <scorum/protocol/betting/market.hpp>
+#include <scorum/chain/schema/game_object.hpp>
+#include <scorum/chain/dba/db_accessor.hpp>
+
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/io/json.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <set>
+
+#include "database_betting_integration.hpp"
+#include "detail.hpp"
+
+#include "benchmark_report.hpp"
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using namespace database_fixture;
+
+using performance_common::benchmark_report;
+using performance_common::cpu_profiler;
+
+namespace {
+
+const uint64_t benchmark_shared_file_size = 1024 * 1024 * 1024ul;
+
+const std::string comment_body = "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor "
+                                 "incididunt ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud "
+                                 "exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.";
+
+// looks for --<name>=<value> among the test runner arguments
+fc::optional<std::string> get_benchmark_option(const std::string& name)
+{
+    const std::string prefix = "--" + name + "=";
+
+    int argc = boost::unit_test::framework::master_test_suite().argc;
+    char** argv = boost::unit_test::framework::master_test_suite().argv;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        if (arg.compare(0, prefix.size(), prefix) == 0)
+            return arg.substr(prefix.size());
+    }
+
+    return fc::optional<std::string>();
+}
+
+// number of operations of each kind put into every generated block
+struct chain_mix
+{
+    std::string name;
+    uint32_t accounts = 0;
+    uint32_t blocks = 0;
+    uint32_t transfers = 0;
+    uint32_t posts = 0;
+    uint32_t votes = 0;
+    uint32_t bets = 0;
+
+    fc::variant_object to_variant() const
+    {
+        fc::mutable_variant_object result;
+        result["accounts"] = accounts;
+        result["blocks"] = blocks;
+        result["transfers_per_block"] = transfers;
+        result["posts_per_block"] = posts;
+        result["votes_per_block"] = votes;
+        result["bets_per_block"] = bets;
+        return result;
+    }
+};
+
+struct comment_ref
+{
+    std::string author;
+    std::string permlink;
+};
+
+/**
+ * Generates a synthetic chain with the requested operation mix, then replays it into a second,
+ * plugin-free database and measures database::push_block for every generated block.
+ */
+struct block_application_benchmark_fixture : public database_betting_integration_fixture
+{
+    block_application_benchmark_fixture()
+        : replay_db(database::opt_default)
+        , generator(42)
+    {
+    }
+
+    ~block_application_benchmark_fixture()
+    {
+        if (replay_data_dir)
+            replay_db.close();
+    }
+
+    virtual void open_database_impl(const genesis_state_type& genesis) override
+    {
+        if (!data_dir)
+        {
+            data_dir = fc::temp_directory(graphene::utilities::temp_directory_path());
+            db.open(data_dir->path(), data_dir->path(), benchmark_shared_file_size, chainbase::database::read_write,
+                    genesis);
+            genesis_state = genesis;
+        }
+    }
+
+    void setup_chain(const chain_mix& mix)
+    {
+        initdelegate.scorum(TEST_ACCOUNTS_INITIAL_SUPPLY);
+        initdelegate.scorumpower(asset(TEST_ACCOUNTS_INITIAL_SUPPLY.amount, SP_SYMBOL));
+        moderator.scorum(TEST_ACCOUNTS_INITIAL_SUPPLY);
+
+        auto gen = Genesis::create()
+                       .accounts_supply(TEST_ACCOUNTS_INITIAL_SUPPLY * (mix.accounts + 2))
+                       .rewards_supply(TEST_REWARD_INITIAL_SUPPLY)
+                       .steemit_bounty_accounts_supply(
+                           asset(TEST_ACCOUNTS_INITIAL_SUPPLY.amount * (mix.accounts + 1), SP_SYMBOL))
+                       .dev_committee(initdelegate)
+                       .accounts(initdelegate, moderator)
+                       .steemit_bounty_accounts(initdelegate)
+                       .witnesses(initdelegate);
+
+        for (uint32_t i = 0; i < mix.accounts; ++i)
+        {
+            Actor a("bench" + std::to_string(i));
+            a.scorum(TEST_ACCOUNTS_INITIAL_SUPPLY);
+            a.scorumpower(asset(TEST_ACCOUNTS_INITIAL_SUPPLY.amount, SP_SYMBOL));
+            gen.accounts(a);
+            gen.steemit_bounty_accounts(a);
+            accounts.push_back(a);
+        }
+
+        open_database(gen.generate());
+        generate_block();
+
+        if (mix.posts || mix.votes)
+        {
+            // every account gets a root post to reply to, root posts are limited to one per
+            // SCORUM_MIN_ROOT_COMMENT_INTERVAL per author, replies only to one per SCORUM_MIN_REPLY_INTERVAL
+            for (const auto& a : accounts)
+                push_comment(a, "", "benchmark");
+            generate_block();
+        }
+
+        if (mix.bets)
+        {
+            empower_moderator(moderator);
+            create_game(moderator, { result_home{} }, SCORUM_BLOCKS_PER_DAY * SCORUM_BLOCK_INTERVAL);
+            generate_block();
+            game_uuid = dba::db_accessor<game_object>(db).get().uuid;
+        }
+    }
+
+    void push(const operation& op, const private_key_type& key)
+    {
+        signed_transaction tx;
+        tx.operations.push_back(op);
+        tx.set_expiration(db.head_block_time() + SCORUM_MAX_TIME_UNTIL_EXPIRATION);
+        tx.sign(key, db.get_chain_id());
+        db.push_transaction(tx, get_skip_flags());
+    }
+
+    void push_comment(const Actor& author, const std::string& parent_author, const std::string& parent_permlink)
+    {
+        comment_operation op;
+        op.parent_author = parent_author;
+        op.parent_permlink = parent_permlink;
+        op.author = author.name;
+        op.permlink = "p" + std::to_string(comments.size());
+        op.title = "benchmark";
+        op.body = comment_body;
+        op.json_metadata = "{\"tags\":[\"benchmark\"]}";
+
+        push(op, author.post_key);
+        comments.push_back({ op.author, op.permlink });
+        last_comment_time[author.name] = db.head_block_time();
+    }
+
+    const Actor& random_account()
+    {
+        return accounts[std::uniform_int_distribution<size_t>(0, accounts.size() - 1)(generator)];
+    }
+
+    void push_transfer()
+    {
+        const Actor& from = random_account();
+        const Actor& to = random_account();
+
+        transfer_operation op;
+        op.from = from.name;
+        op.to = to.name;
+        op.amount = ASSET_SCR(1);
+        op.memo = std::to_string(++transfers_count);
+
+        push(op, from.private_key);
+    }
+
+    void push_reply()
+    {
+        // authors who replied too recently are skipped, the next eligible one is used instead
+        for (size_t attempt = 0; attempt < accounts.size(); ++attempt)
+        {
+            const Actor& author = random_account();
+            if (db.head_block_time() - last_comment_time[author.name] < SCORUM_MIN_REPLY_INTERVAL)
+                continue;
+
+            // the first comments are the root posts created in setup_chain
+            size_t parent_index = std::uniform_int_distribution<size_t>(0, accounts.size() - 1)(generator);
+            const comment_ref parent = comments[parent_index];
+            push_comment(author, parent.author, parent.permlink);
+            return;
+        }
+    }
+
+    void push_vote()
+    {
+        // every voter votes for a comment only once
+        for (size_t attempt = 0; attempt < accounts.size(); ++attempt)
+        {
+            const Actor& voter = random_account();
+            size_t comment_index = std::uniform_int_distribution<size_t>(0, comments.size() - 1)(generator);
+            if (!votes.insert(std::make_pair(voter.name, comment_index)).second)
+                continue;
+
+            vote_operation op;
+            op.voter = voter.name;
+            op.author = comments[comment_index].author;
+            op.permlink = comments[comment_index].permlink;
+            op.weight = SCORUM_PERCENT(10);
+
+            push(op, voter.post_key);
+            return;
+        }
+    }
+
+    void push_bet()
+    {
+        const Actor& better = random_account();
+
+        post_bet_operation op;
+        op.uuid = gen_uuid("bet" + std::to_string(++bets_count));
+        op.better = better.name;
+        op.game_uuid = game_uuid;
+        if (bets_count % 2)
+            op.wincase = result_home::yes();
+        else
+            op.wincase = result_home::no();
+        op.odds = { 2, 1 };
+        op.stake = SCORUM_MIN_BET_STAKE;
+        op.live = false;
+
+        push(op, better.private_key);
+    }
+
+    void generate_chain(const chain_mix& mix)
+    {
+        first_benchmark_block = db.head_block_num() + 1;
+
+        for (uint32_t block = 0; block < mix.blocks; ++block)
+        {
+            for (uint32_t i = 0; i < mix.transfers; ++i)
+                push_transfer();
+            for (uint32_t i = 0; i < mix.posts; ++i)
+                push_reply();
+            for (uint32_t i = 0; i < mix.votes; ++i)
+                push_vote();
+            for (uint32_t i = 0; i < mix.bets; ++i)
+                push_bet();
+
+            generate_block();
+        }
+    }
+
+    benchmark_report replay_chain(const std::string& name)
+    {
+        benchmark_report report(name);
+
+        replay_data_dir = fc::temp_directory(graphene::utilities::temp_directory_path());
+        replay_db.open(replay_data_dir->path(), replay_data_dir->path(), benchmark_shared_file_size,
+                       chainbase::database::read_write, genesis_state);
+
+        // validate blocks the way they were generated, skipping the invariant checks like a syncing node does
+        const uint32_t skip = get_skip_flags() | database::skip_validate_invariants;
+
+        for (uint32_t num = 1; num <= db.head_block_num(); ++num)
+        {
+            auto block = db.fetch_block_by_number(num);
+            BOOST_REQUIRE(block.valid());
+
+            if (num < first_benchmark_block)
+            {
+                replay_db.push_block(*block, skip);
+                continue;
+            }
+
+            uint64_t operations = 0;
+            for (const auto& trx : block->transactions)
+                operations += trx.operations.size();
+
+            cpu_profiler prof;
+            replay_db.push_block(*block, skip);
+            report.add_sample(prof.elapsed_microseconds(), operations);
+        }
+
+        BOOST_REQUIRE(replay_db.head_block_id() == db.head_block_id());
+
+        return report;
+    }
+
+    void run(chain_mix mix)
+    {
+        if (auto blocks = get_benchmark_option("benchmark-blocks"))
+            mix.blocks = boost::lexical_cast<uint32_t>(*blocks);
+
+        setup_chain(mix);
+        generate_chain(mix);
+
+        auto report = replay_chain("block_application." + mix.name).to_variant(mix.to_variant());
+
+        std::string json = fc::json::to_pretty_string(report);
+        std::cout << json << std::endl;
+
+        if (auto report_file = get_benchmark_option("benchmark-report"))
+        {
+            std::ofstream out(*report_file, std::ios::app);
+            out << fc::json::to_string(report) << std::endl;
+        }
+
+        fc::path baseline_file(BOOST_PP_STRINGIZE(SRC_DIR));
+        baseline_file /= "baselines";
+        baseline_file /= "block_application.json";
+        if (auto baseline = get_benchmark_option("benchmark-baseline"))
+            baseline_file = *baseline;
+
+        for (const auto& regression : performance_common::find_regressions(report, baseline_file))
+            BOOST_ERROR(regression);
+    }
+
+    Actor moderator = "moderator";
+    std::vector<Actor> accounts;
+
+    std::vector<comment_ref> comments;
+    std::map<std::string, fc::time_point_sec> last_comment_time;
+    std::set<std::pair<std::string, size_t>> votes;
+
+    uint64_t transfers_count = 0;
+    uint64_t bets_count = 0;
+    scorum::uuid_type game_uuid;
+
+    uint32_t first_benchmark_block = 0;
+
+    database replay_db;
+    fc::optional<fc::temp_directory> replay_data_dir;
+
+    std::mt19937 generator;
+};
+
+chain_mix make_mix(const std::string& name, uint32_t transfers, uint32_t posts, uint32_t votes, uint32_t bets)
+{
+    chain_mix mix;
+    mix.name = name;
+    mix.accounts = 100;
+    mix.blocks = 200;
+    mix.transfers = transfers;
+    mix.posts = posts;
+    mix.votes = votes;
+    mix.bets = bets;
+    return mix;
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE(block_application_benchmark_tests, block_application_benchmark_fixture)
+
+SCORUM_TEST_CASE(transfers_benchmark)
+{
+    run(make_mix("transfers", 50, 0, 0, 0));
+}
+
+SCORUM_TEST_CASE(blog_benchmark)
+{
+    run(make_mix("blog", 0, 5, 30, 0));
+}
+
+SCORUM_TEST_CASE(betting_benchmark)
+{
+    run(make_mix("betting", 0, 0, 0, 30));
+}
+
+SCORUM_TEST_CASE(mixed_benchmark)
+{
+    run(make_mix("mixed", 20, 3, 15, 10));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
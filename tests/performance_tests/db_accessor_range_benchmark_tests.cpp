@@ -0,0 +1,85 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/dba/db_accessor.hpp>
+#include <scorum/chain/schema/bet_objects.hpp>
+
+#include "database_trx_integration.hpp"
+#include "detail.hpp"
+
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using namespace database_fixture;
+
+using performance_common::measure_walks;
+
+namespace {
+
+/**
+ * Walks the matched bets of one game (the shape of the betting resolver loop) through the type-erased
+ * get_range_by and through get_index_range_by, which keeps the multi-index iterators.
+ */
+struct db_accessor_range_benchmark_fixture : public database_trx_integration_fixture
+{
+    db_accessor_range_benchmark_fixture()
+        : matched_bet_dba(db.get_dba<matched_bet_object>())
+    {
+        open_database();
+        generate_block();
+    }
+
+    void create_bets(size_t count)
+    {
+        db_plugin->debug_update(
+            [&](database&) {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    db.create<matched_bet_object>([&](matched_bet_object& o) {
+                        o.game_uuid = game_uuid;
+                        o.bet1_data.stake = ASSET_SCR(i + 1);
+                        o.bet2_data.stake = ASSET_SCR(i + 1);
+                    });
+                }
+            },
+            get_skip_flags());
+    }
+
+    template <typename Range> static share_type sum(const Range& bets)
+    {
+        share_type result = 0;
+        for (const matched_bet_object& bet : bets)
+            result += bet.bet1_data.stake.amount + bet.bet2_data.stake.amount;
+        return result;
+    }
+
+    dba::db_accessor<matched_bet_object>& matched_bet_dba;
+
+    const uuid_type game_uuid = gen_uuid("game");
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(db_accessor_range_benchmark_tests, db_accessor_range_benchmark_fixture)
+
+SCORUM_TEST_CASE(erased_vs_index_range_iteration_benchmark)
+{
+    const size_t cycles = 100;
+
+    size_t created = 0;
+    for (size_t bets : { 1'000u, 10'000u, 100'000u })
+    {
+        create_bets(bets - created);
+        created = bets;
+
+        size_t erased_time = measure_walks(
+            db, cycles, [&]() { return sum(matched_bet_dba.get_range_by<by_game_uuid_market>(game_uuid)); });
+        size_t index_time = measure_walks(
+            db, cycles, [&]() { return sum(matched_bet_dba.get_index_range_by<by_game_uuid_market>(game_uuid)); });
+
+        BOOST_TEST_MESSAGE(bets << " matched bets x " << cycles << " walks: any_range " << erased_time
+                                << "us, index range " << index_time << "us");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,105 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/peer_database.hpp>
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+
+#include "defines.hpp"
+
+#include "performance_common.hpp"
+
+namespace peer_database_load_benchmark_tests {
+
+using graphene::net::peer_database;
+using graphene::net::potential_peer_record;
+
+using performance_common::cpu_profiler;
+
+/**
+ * Opens peer tables saved by former versions as JSON and in the binary format. Both are pruned to the same size
+ * after loading, so the difference is the parsing.
+ */
+struct peer_database_load_benchmark_fixture
+{
+    peer_database_load_benchmark_fixture()
+        : data_dir(graphene::utilities::temp_directory_path())
+    {
+    }
+
+    std::vector<potential_peer_record> make_records(uint32_t count)
+    {
+        std::vector<potential_peer_record> result;
+        result.reserve(count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            potential_peer_record record(fc::ip::endpoint(fc::ip::address(0x0a000000 + i), 1776),
+                                         fc::time_point_sec(1000 + i), graphene::net::last_connection_failed);
+            record.last_connection_attempt_time = fc::time_point_sec(2000 + i);
+            record.number_of_failed_connection_attempts = i % 10;
+            result.push_back(record);
+        }
+        return result;
+    }
+
+    fc::path make_binary_file(const std::vector<potential_peer_record>& records, const std::string& name)
+    {
+        fc::path filename = data_dir.path() / name;
+
+        peer_database db;
+        db.open(filename);
+        for (const auto& record : records)
+            db.update_entry(record);
+
+        return filename;
+    }
+
+    fc::temp_directory data_dir;
+};
+
+BOOST_FIXTURE_TEST_SUITE(peer_database_load_benchmark_tests, peer_database_load_benchmark_fixture)
+
+SCORUM_TEST_CASE(json_vs_binary_load_benchmark)
+{
+    for (uint32_t count : { 10'000u, 50'000u, 100'000u })
+    {
+        auto records = make_records(count);
+
+        fc::path json_filename = data_dir.path() / ("peers_" + std::to_string(count) + ".json");
+        fc::json::save_to_file(records, json_filename);
+
+        fc::path binary_filename = make_binary_file(records, "peers_" + std::to_string(count) + ".dat");
+
+        size_t json_time = 0;
+        {
+            peer_database db;
+            fc::path migrated_filename = data_dir.path() / ("migrated_" + std::to_string(count) + ".dat");
+
+            cpu_profiler prof;
+            db.open(migrated_filename, json_filename);
+            json_time = prof.elapsed_microseconds();
+
+            BOOST_REQUIRE_GT(db.size(), 0u);
+        }
+
+        size_t binary_time = 0;
+        {
+            auto binary_size = fc::file_size(binary_filename);
+            peer_database db;
+
+            cpu_profiler prof;
+            db.open(binary_filename);
+            binary_time = prof.elapsed_microseconds();
+
+            BOOST_REQUIRE_GT(db.size(), 0u);
+            BOOST_TEST_MESSAGE(count << " peers: json " << fc::file_size(json_filename) << " bytes, binary "
+                                     << binary_size << " bytes");
+        }
+
+        BOOST_TEST_MESSAGE(count << " peers: json load " << json_time << "us, binary load " << binary_time << "us");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
@@ -11,4 +11,10 @@ size_t cpu_profiler::elapsed() const
     auto now = std::chrono::steady_clock::now();
     return (size_t)std::chrono::duration_cast<std::chrono::milliseconds>(now - _start).count();
 }
+
+size_t cpu_profiler::elapsed_microseconds() const
+{
+    auto now = std::chrono::steady_clock::now();
+    return (size_t)std::chrono::duration_cast<std::chrono::microseconds>(now - _start).count();
+}
 }
@@ -1,6 +1,10 @@
+#pragma once
+
 #include <chrono>
 #include <algorithm>
 
+#include <boost/test/unit_test.hpp>
+
 namespace performance_common {
 class cpu_profiler
 {
@@ -10,7 +14,26 @@ public:
     // milliseconds
     size_t elapsed() const;
 
+    size_t elapsed_microseconds() const;
+
 private:
     std::chrono::time_point<std::chrono::steady_clock> _start;
 };
+
+/// runs walk the given number of cycles under the read lock and returns the elapsed microseconds,
+/// walk returns a sum of what it visited so the compiler can't drop it
+template <typename Database, typename Walk> size_t measure_walks(Database& db, size_t cycles, Walk&& walk)
+{
+    return db.with_read_lock([&]() {
+        cpu_profiler prof;
+
+        decltype(walk()) total = 0;
+        for (size_t ci = 0; ci < cycles; ++ci)
+            total += walk();
+
+        BOOST_REQUIRE_GT(total, 0);
+
+        return prof.elapsed_microseconds();
+    });
+}
 }
@@ -0,0 +1,175 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_context.hpp>
+#include <scorum/app/betting_api_impl.hpp>
+
+#include <scorum/account_bets/account_bets_plugin.hpp>
+#include <scorum/account_bets/account_bets_api.hpp>
+#include <scorum/account_bets/account_bets_objects.hpp>
+
+#include "database_trx_integration.hpp"
+
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+using namespace scorum::app;
+
+using namespace database_fixture;
+
+using performance_common::cpu_profiler;
+
+namespace {
+
+/**
+ * Collects all open bets of one account, by paging lookup_pending_bets/lookup_matched_bets over the whole set
+ * and filtering (what wallets had to do) and through account_bets_api.
+ */
+struct account_bets_benchmark_fixture : public database_trx_integration_fixture
+{
+    account_bets_benchmark_fixture()
+        : api(db.get_dba<betting_property_object>(),
+              db.get_dba<game_object>(),
+              db.get_dba<matched_bet_object>(),
+              db.get_dba<pending_bet_object>())
+        , _api_ctx(app, API_ACCOUNT_BETS, std::make_shared<api_session_data>())
+        , account_api(_api_ctx)
+    {
+        init_plugin<scorum::account_bets::account_bets_plugin>();
+
+        open_database();
+        generate_block();
+    }
+
+    static std::string better(size_t i)
+    {
+        return "better" + std::to_string(i);
+    }
+
+    /// objects are created directly, so the links the plugin keeps for them are created here as well
+    void create_bets(size_t count)
+    {
+        using scorum::account_bets::account_bet_object;
+
+        auto link = [&](const std::string& name, bet_kind kind, int64_t bet_id) {
+            db.create<account_bet_object>([&](account_bet_object& o) {
+                o.better = name;
+                o.kind = kind;
+                o.bet_id = bet_id;
+            });
+        };
+
+        db_plugin->debug_update(
+            [&](database&) {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const auto& pending = db.create<pending_bet_object>(
+                        [&](pending_bet_object& o) { o.data.better = better(i % betters_count); });
+                    link(pending.data.better, bet_kind::pending, pending.id._id);
+
+                    const auto& matched = db.create<matched_bet_object>([&](matched_bet_object& o) {
+                        o.bet1_data.better = better(i % betters_count);
+                        o.bet2_data.better = better((i + 1) % betters_count);
+                    });
+                    link(matched.bet1_data.better, bet_kind::matched, matched.id._id);
+                    link(matched.bet2_data.better, bet_kind::matched, matched.id._id);
+                }
+            },
+            get_skip_flags());
+    }
+
+    template <typename TApiObject, typename TId, typename Lookup, typename Filter>
+    std::vector<TApiObject> page_all(Lookup&& lookup, Filter&& filter)
+    {
+        std::vector<TApiObject> result;
+
+        TId from = 0;
+        for (auto page = lookup(from); !page.empty(); page = lookup(from))
+        {
+            for (const auto& obj : page)
+            {
+                if (filter(obj))
+                    result.push_back(obj);
+            }
+            from = TId(page.back().id._id + 1);
+        }
+
+        return result;
+    }
+
+    size_t scan(const std::string& name)
+    {
+        return db.with_read_lock([&]() {
+            cpu_profiler prof;
+
+            auto pending = page_all<pending_bet_api_object, pending_bet_id_type>(
+                [&](pending_bet_id_type from) { return api.lookup_pending_bets(from, LOOKUP_LIMIT); },
+                [&](const pending_bet_api_object& o) { return o.data.better == name; });
+
+            auto matched = page_all<matched_bet_api_object, matched_bet_id_type>(
+                [&](matched_bet_id_type from) { return api.lookup_matched_bets(from, LOOKUP_LIMIT); },
+                [&](const matched_bet_api_object& o) {
+                    return o.bet1_data.better == name || o.bet2_data.better == name;
+                });
+
+            BOOST_REQUIRE_EQUAL(pending.size() + matched.size(), _expected);
+
+            return prof.elapsed_microseconds();
+        });
+    }
+
+    /// account_bets_api takes the read lock itself
+    size_t indexed(const std::string& name)
+    {
+        cpu_profiler prof;
+
+        auto pending = page_all<pending_bet_api_object, pending_bet_id_type>(
+            [&](pending_bet_id_type from) { return account_api.get_account_pending_bets(name, from, LOOKUP_LIMIT); },
+            [](const pending_bet_api_object&) { return true; });
+
+        auto matched = page_all<matched_bet_api_object, matched_bet_id_type>(
+            [&](matched_bet_id_type from) { return account_api.get_account_matched_bets(name, from, LOOKUP_LIMIT); },
+            [](const matched_bet_api_object&) { return true; });
+
+        BOOST_REQUIRE_EQUAL(pending.size() + matched.size(), _expected);
+
+        return prof.elapsed_microseconds();
+    }
+
+    betting_api::impl api;
+
+    api_context _api_ctx;
+    scorum::account_bets::account_bets_api account_api;
+
+    const size_t betters_count = 1'000;
+
+    size_t _expected = 0;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(account_bets_benchmark_tests, account_bets_benchmark_fixture)
+
+SCORUM_TEST_CASE(account_bets_scan_vs_plugin_benchmark)
+{
+    const size_t bets_count = 100'000;
+
+    create_bets(bets_count);
+
+    // each better has bets_count / betters_count pending bets and is on both sides of as many matched bets
+    _expected = 3 * bets_count / betters_count;
+
+    const size_t queries = 20;
+
+    size_t scan_time = 0;
+    size_t index_time = 0;
+    for (size_t i = 0; i < queries; ++i)
+    {
+        scan_time += scan(better(i));
+        index_time += indexed(better(i));
+    }
+
+    BOOST_TEST_MESSAGE(queries << " accounts, " << bets_count << " pending and matched bets: scan " << scan_time
+                               << "us, account_bets_api " << index_time << "us");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
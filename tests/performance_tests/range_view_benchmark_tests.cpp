@@ -0,0 +1,114 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/services/account.hpp>
+#include <scorum/chain/services/dynamic_global_property.hpp>
+
+#include "database_trx_integration.hpp"
+
+#include "performance_common.hpp"
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using namespace database_fixture;
+
+using performance_common::measure_walks;
+
+namespace {
+
+/**
+ * Walks the active SP holders range of the account index (the shape of the reward distribution loop)
+ * by copying it into a vector of references and by iterating the lazy view over the same index.
+ */
+struct range_view_benchmark_fixture : public database_trx_integration_fixture
+{
+    range_view_benchmark_fixture()
+    {
+        open_database();
+        generate_block();
+
+        _head_time = db.head_block_time();
+    }
+
+    void create_accounts(size_t count)
+    {
+        db_plugin->debug_update(
+            [&](database&) {
+                for (size_t i = _accounts; i < count; ++i)
+                {
+                    db.create<account_object>([&](account_object& o) {
+                        o.name = "bench" + std::to_string(i);
+                        // every second account has voted recently
+                        o.voting_power_restoring_time = _head_time + fc::seconds(i % 2 ? 60 : -60);
+                        o.vote_reward_competitive_sp = ASSET_SP(i + 1);
+                    });
+                }
+            },
+            get_skip_flags());
+
+        _accounts = std::max(_accounts, count);
+    }
+
+    dbs_account& account_service()
+    {
+        return static_cast<dbs_account&>(db.account_service());
+    }
+
+    share_type sum_vector()
+    {
+        auto accounts = account_service().get_range_by<by_voting_power_restoring_time>(
+            db.head_block_time() < boost::lambda::_1, boost::multi_index::unbounded);
+
+        share_type sum = 0;
+        for (const account_object& a : accounts)
+            sum += a.vote_reward_competitive_sp.amount;
+        return sum;
+    }
+
+    share_type sum_view()
+    {
+        auto accounts = account_service().get_range_view_by<by_voting_power_restoring_time>(
+            db.head_block_time() < boost::lambda::_1, boost::multi_index::unbounded);
+
+        share_type sum = 0;
+        for (const account_object& a : accounts)
+            sum += a.vote_reward_competitive_sp.amount;
+        return sum;
+    }
+
+    share_type sum_any_view()
+    {
+        share_type sum = 0;
+        for (const account_object& a : db.account_service().get_active_sp_holders())
+            sum += a.vote_reward_competitive_sp.amount;
+        return sum;
+    }
+
+    fc::time_point_sec _head_time;
+    size_t _accounts = 0;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(range_view_benchmark_tests, range_view_benchmark_fixture)
+
+SCORUM_TEST_CASE(vector_materialisation_vs_view_iteration_benchmark)
+{
+    for (size_t count : { 1'000u, 10'000u, 100'000u })
+    {
+        create_accounts(count);
+
+        const size_t cycles = 1'000'000 / count;
+
+        BOOST_REQUIRE_EQUAL(sum_vector(), sum_view());
+        BOOST_REQUIRE_EQUAL(sum_vector(), sum_any_view());
+
+        size_t vector_time = measure_walks(db, cycles, [&]() { return sum_vector(); });
+        size_t view_time = measure_walks(db, cycles, [&]() { return sum_view(); });
+        size_t any_view_time = measure_walks(db, cycles, [&]() { return sum_any_view(); });
+
+        BOOST_TEST_MESSAGE(count << " accounts, " << cycles << " walks: vector " << vector_time << "us, view "
+                                 << view_time << "us, type erased view " << any_view_time << "us");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/signature_cache.hpp>
+#include <scorum/protocol/operations.hpp>
+
+#include "defines.hpp"
+
+#include "performance_common.hpp"
+
+#include <thread>
+
+namespace signature_recovery_benchmark_tests {
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+using performance_common::cpu_profiler;
+
+/**
+ * Verifies signatures of a block worth of transactions on one thread and with recover_in_parallel. Part of the
+ * transactions is already in the cache, as it happens for transactions received by the mempool before the block.
+ */
+struct signature_recovery_benchmark_fixture
+{
+    signature_recovery_benchmark_fixture()
+    {
+        for (size_t i = 0; i < transactions_count; ++i)
+        {
+            transfer_operation op;
+            op.from = "alice";
+            op.to = "bob";
+            op.amount = ASSET_SCR(1);
+            op.memo = std::to_string(i);
+
+            signed_transaction tx;
+            tx.operations.push_back(op);
+            tx.set_expiration(fc::time_point_sec(1000));
+            tx.sign(private_key_type::regenerate(fc::sha256::hash(std::to_string(i))), chain_id);
+
+            transactions.push_back(tx);
+        }
+    }
+
+    size_t verify_block(uint32_t threads, size_t seen_percent)
+    {
+        signature_cache cache;
+        // the threads are started once at startup, as the database does
+        cache.set_recovery_threads(threads);
+
+        std::vector<signed_transaction> seen(transactions.begin(),
+                                             transactions.begin() + transactions.size() * seen_percent / 100);
+        for (const auto& tx : seen)
+            cache.get_signature_keys(tx, chain_id);
+
+        cpu_profiler prof;
+
+        cache.recover_in_parallel(transactions, chain_id);
+
+        for (const auto& tx : transactions)
+            cache.get_signature_keys(tx, chain_id);
+
+        return prof.elapsed_microseconds();
+    }
+
+    const size_t transactions_count = 1000;
+
+    chain_id_type chain_id = chain_id_type::hash(std::string("signature_recovery_benchmark"));
+    std::vector<signed_transaction> transactions;
+};
+
+BOOST_FIXTURE_TEST_SUITE(signature_recovery_benchmark_tests, signature_recovery_benchmark_fixture)
+
+SCORUM_TEST_CASE(parallel_recovery_benchmark)
+{
+    const uint32_t cores = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t serial_cold = 0;
+    size_t parallel_cold = 0;
+
+    for (size_t seen_percent : { 0, 50, 90 })
+    {
+        for (uint32_t threads : { 1u, 2u, 4u, cores })
+        {
+            size_t elapsed = verify_block(threads, seen_percent);
+
+            BOOST_TEST_MESSAGE(transactions_count << " transactions, " << seen_percent << "% seen before, " << threads
+                                                  << " threads: " << elapsed << "us");
+
+            if (seen_percent == 0 && threads == 1)
+                serial_cold = elapsed;
+            if (seen_percent == 0 && threads == cores)
+                parallel_cold = elapsed;
+        }
+    }
+
+    if (cores > 1)
+    {
+        BOOST_CHECK_LT(parallel_cold, serial_cold);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
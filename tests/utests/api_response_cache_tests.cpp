@@ -0,0 +1,110 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/api_response_cache.hpp>
+
+#include "defines.hpp"
+
+#include <thread>
+
+namespace {
+
+using namespace scorum::app;
+
+struct api_response_cache_fixture
+{
+    api_response_cache_fixture()
+    {
+        cache.enable_method("test_api.get_value");
+    }
+
+    std::string get_value(const std::string& param)
+    {
+        return cache.get("test_api", "get_value", [&]() { return param + std::to_string(++calls); }, param);
+    }
+
+    api_response_cache cache{ 100 };
+    int calls = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(api_response_cache_tests, api_response_cache_fixture)
+
+SCORUM_TEST_CASE(result_is_computed_once_per_params)
+{
+    BOOST_CHECK_EQUAL(get_value("a"), "a1");
+    BOOST_CHECK_EQUAL(get_value("a"), "a1");
+    BOOST_CHECK_EQUAL(get_value("b"), "b2");
+    BOOST_CHECK_EQUAL(calls, 2);
+
+    auto stats = cache.get_stats()["test_api.get_value"];
+    BOOST_CHECK_EQUAL(stats.hits, 1u);
+    BOOST_CHECK_EQUAL(stats.misses, 2u);
+    BOOST_CHECK_EQUAL(stats.size, 2u);
+}
+
+SCORUM_TEST_CASE(invalidate_drops_results)
+{
+    get_value("a");
+    cache.invalidate();
+
+    BOOST_CHECK_EQUAL(get_value("a"), "a2");
+    BOOST_CHECK_EQUAL(cache.get_stats()["test_api.get_value"].size, 1u);
+}
+
+SCORUM_TEST_CASE(result_computed_before_invalidation_is_not_cached)
+{
+    cache.get("test_api", "get_value",
+              [&]() {
+                  // a block is applied meanwhile
+                  cache.invalidate();
+                  return std::string("stale");
+              },
+              std::string("a"));
+
+    BOOST_CHECK_EQUAL(get_value("a"), "a1");
+}
+
+SCORUM_TEST_CASE(not_enabled_methods_are_not_cached)
+{
+    auto get_other = [&]() { return cache.get("test_api", "get_other", [&]() { return ++calls; }); };
+
+    BOOST_CHECK_EQUAL(get_other(), 1);
+    BOOST_CHECK_EQUAL(get_other(), 2);
+    BOOST_CHECK_EQUAL(cache.get_stats().count("test_api.get_other"), 0u);
+}
+
+SCORUM_TEST_CASE(zero_size_disables_cache)
+{
+    cache.set_max_size(0);
+
+    get_value("a");
+    BOOST_CHECK_EQUAL(get_value("a"), "a2");
+}
+
+SCORUM_TEST_CASE(oldest_results_are_evicted)
+{
+    cache.set_max_size(2);
+
+    get_value("a");
+    get_value("b");
+    get_value("c");
+
+    BOOST_CHECK_EQUAL(get_value("c"), "c3");
+    BOOST_CHECK_EQUAL(get_value("a"), "a4");
+    BOOST_CHECK_EQUAL(cache.get_stats()["test_api.get_value"].size, 2u);
+}
+
+SCORUM_TEST_CASE(results_expire_by_ttl)
+{
+    api_response_cache::method_config config;
+    config.ttl_ms = 1;
+    cache.enable_method("test_api.get_value", config);
+
+    get_value("a");
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    BOOST_CHECK_EQUAL(get_value("a"), "a2");
+    BOOST_CHECK_EQUAL(cache.get_stats()["test_api.get_value"].size, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
@@ -45,19 +45,6 @@ public:
 
 BOOST_AUTO_TEST_SUITE(betting_api_tests)
 
-BOOST_FIXTURE_TEST_CASE(get_games_dont_throw, fixture)
-{
-    namespace dd = dba::detail;
-
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
-
-    std::vector<game_object> objects;
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
-
-    BOOST_REQUIRE_NO_THROW(api.get_games_by_status({ game_status::resolved }));
-}
-
 struct get_game_winners_fixture : public fixture
 {
     scorum::uuid_type uuid_ns = boost::uuids::string_generator()("00000000-0000-0000-0000-000000000001");
@@ -240,37 +227,43 @@ BOOST_FIXTURE_TEST_CASE(trd_state_markets_without_winner_are_not_returned, get_g
 
 struct get_games_fixture : public fixture
 {
+    db_mock db;
+    dba::db_accessor<game_object> games_dba;
+
     get_games_fixture()
+        : games_dba(db)
     {
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::created; }));
-
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::started; }));
-
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::finished; }));
-
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::resolved; }));
-
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::expired; }));
+        db.add_index<game_index>();
 
-        objects.push_back(
-            create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::cancelled; }));
+        // start time goes backwards to check that creation order is kept
+        create_game(game_status::created, 60);
+        create_game(game_status::started, 50);
+        create_game(game_status::finished, 40);
+        create_game(game_status::resolved, 30);
+        create_game(game_status::expired, 20);
+        create_game(game_status::cancelled, 10);
     }
 
-    std::vector<game_object> objects;
+    void create_game(game_status status, uint32_t start_time)
+    {
+        db.create<game_object>([&](game_object& game) {
+            game.status = status;
+            game.start_time = fc::time_point_sec(start_time);
+        });
+    }
 };
 
-BOOST_FIXTURE_TEST_CASE(get_games_return_all_games_in_creation_order, get_games_fixture)
+BOOST_FIXTURE_TEST_CASE(get_games_dont_throw, get_games_fixture)
 {
-    namespace dd = dba::detail;
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
 
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
+    BOOST_REQUIRE_NO_THROW(api.get_games_by_status({ game_status::resolved }));
+    BOOST_REQUIRE_NO_THROW(api.get_games_by_status({}));
+}
 
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+BOOST_FIXTURE_TEST_CASE(get_games_return_all_games_in_creation_order, get_games_fixture)
+{
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games
         = api.get_games_by_status({ game_status::started, game_status::created, game_status::finished,
                                     game_status::cancelled, game_status::expired, game_status::resolved });
@@ -286,11 +279,7 @@ BOOST_FIXTURE_TEST_CASE(get_games_return_all_games_in_creation_order, get_games_
 
 BOOST_FIXTURE_TEST_CASE(return_games_with_created_status, get_games_fixture)
 {
-    namespace dd = dba::detail;
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
-
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games = api.get_games_by_status({ game_status::created });
 
     BOOST_REQUIRE_EQUAL(games.size(), 1);
@@ -299,11 +288,7 @@ BOOST_FIXTURE_TEST_CASE(return_games_with_created_status, get_games_fixture)
 
 BOOST_FIXTURE_TEST_CASE(return_games_with_started_status, get_games_fixture)
 {
-    namespace dd = dba::detail;
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
-
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games = api.get_games_by_status({ game_status::started });
 
     BOOST_REQUIRE_EQUAL(games.size(), 1);
@@ -312,11 +297,7 @@ BOOST_FIXTURE_TEST_CASE(return_games_with_started_status, get_games_fixture)
 
 BOOST_FIXTURE_TEST_CASE(return_games_with_finished_status, get_games_fixture)
 {
-    namespace dd = dba::detail;
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
-
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games = api.get_games_by_status({ game_status::finished });
 
     BOOST_REQUIRE_EQUAL(games.size(), 1);
@@ -325,11 +306,7 @@ BOOST_FIXTURE_TEST_CASE(return_games_with_finished_status, get_games_fixture)
 
 BOOST_FIXTURE_TEST_CASE(return_games_with_created_finished_cancelled_status, get_games_fixture)
 {
-    namespace dd = dba::detail;
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
-
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games
         = api.get_games_by_status({ game_status::finished, game_status::created, game_status::cancelled });
 
@@ -341,13 +318,9 @@ BOOST_FIXTURE_TEST_CASE(return_games_with_created_finished_cancelled_status, get
 
 BOOST_FIXTURE_TEST_CASE(return_two_games_with_finished_status, get_games_fixture)
 {
-    namespace dd = dba::detail;
-
-    objects.push_back(create_object<game_object>(shm, [&](game_object& game) { game.status = game_status::finished; }));
-
-    mocks.ExpectCallFunc((dd::get_all_by<game_object, by_id>)).Return({ objects.begin(), objects.end() });
+    create_game(game_status::finished, 70);
 
-    betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
     std::vector<game_api_object> games = api.get_games_by_status({ game_status::finished });
 
     BOOST_REQUIRE_EQUAL(games.size(), 2);
@@ -355,6 +328,43 @@ BOOST_FIXTURE_TEST_CASE(return_two_games_with_finished_status, get_games_fixture
     BOOST_CHECK(games[1].status == game_status::finished);
 }
 
+BOOST_FIXTURE_TEST_CASE(lookup_games_by_status_should_return_games_within_time_window, get_games_fixture)
+{
+    create_game(game_status::started, 70);
+    create_game(game_status::started, 80);
+    create_game(game_status::started, 90);
+
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
+    std::vector<game_api_object> games = api.lookup_games_by_status(
+        game_status::started, fc::time_point_sec(60), fc::time_point_sec(80), game_id_type(0), 100);
+
+    BOOST_REQUIRE_EQUAL(games.size(), 2u);
+    BOOST_CHECK_EQUAL(games[0].start_time.sec_since_epoch(), 70u);
+    BOOST_CHECK_EQUAL(games[1].start_time.sec_since_epoch(), 80u);
+}
+
+BOOST_FIXTURE_TEST_CASE(lookup_games_by_status_should_page_games_starting_at_same_time, get_games_fixture)
+{
+    create_game(game_status::created, 70);
+    create_game(game_status::created, 70);
+    create_game(game_status::created, 70);
+
+    betting_api_impl api(betting_prop_dba, games_dba, matched_bet_dba, pending_bet_dba);
+
+    auto first = api.lookup_games_by_status(game_status::created, fc::time_point_sec(65),
+                                            fc::time_point_sec::maximum(), game_id_type(0), 2);
+
+    BOOST_REQUIRE_EQUAL(first.size(), 2u);
+    BOOST_CHECK_EQUAL(first[0].id._id, 6);
+    BOOST_CHECK_EQUAL(first[1].id._id, 7);
+
+    auto next = api.lookup_games_by_status(game_status::created, first.back().start_time,
+                                           fc::time_point_sec::maximum(), game_id_type(first.back().id._id + 1), 2);
+
+    BOOST_REQUIRE_EQUAL(next.size(), 1u);
+    BOOST_CHECK_EQUAL(next[0].id._id, 8);
+}
+
 BOOST_FIXTURE_TEST_CASE(throw_exception_when_limit_is_negative, get_games_fixture)
 {
     betting_api_impl api(betting_prop_dba, game_dba, matched_bet_dba, pending_bet_dba);
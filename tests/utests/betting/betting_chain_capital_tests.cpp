@@ -118,6 +118,91 @@ SCORUM_TEST_CASE(bets_resolving_should_change_matched_betting_capital)
     BOOST_CHECK_EQUAL(0u, dprop_dba.get().betting_stats.matched_bets_volume.amount);
 }
 
+SCORUM_TEST_CASE(bets_resolving_should_pay_each_better_total_income)
+{
+    // clang-format off
+    account_dba.create([](account_object& o) { o.name = "alice"; });
+    account_dba.create([](account_object& o) { o.name = "bob"; });
+    // clang-format on
+    game_dba.create([](game_object& o) {});
+    for (int i = 0; i < 3; ++i)
+    {
+        matched_bet_dba.create([&](matched_bet_object& o) {
+            o.game_uuid = { 0 };
+            o.market = result_home{};
+            o.bet1_data.better = "alice";
+            o.bet1_data.stake = ASSET_SCR(100);
+            o.bet1_data.wincase = result_home::yes{};
+            o.bet2_data.better = "bob";
+            o.bet2_data.stake = ASSET_SCR(200);
+            o.bet2_data.wincase = i == 2 ? wincase_type(result_home::yes{}) : wincase_type(result_home::no{});
+        });
+    }
+    dprop_dba.create([&](dynamic_global_property_object& o) { o.betting_stats.matched_bets_volume = ASSET_SCR(900); });
+
+    betting_resolver resolver(account_svc, *vop_emitter, matched_bet_dba, game_dba, dprop_dba);
+
+    resolver.resolve_matched_bets({ 0 }, { result_home::no{} });
+
+    BOOST_CHECK_EQUAL(account_dba.get_by<by_name>(account_name_type("alice")).balance, ASSET_SCR(100));
+    BOOST_CHECK_EQUAL(account_dba.get_by<by_name>(account_name_type("bob")).balance, ASSET_SCR(800));
+    BOOST_CHECK_EQUAL(0u, dprop_dba.get().betting_stats.matched_bets_volume.amount);
+    BOOST_CHECK(matched_bet_dba.is_empty());
+}
+
+SCORUM_TEST_CASE(bets_resolving_should_emit_virtual_operations_in_bet_order)
+{
+    // clang-format off
+    account_dba.create([](account_object& o) { o.name = "alice"; });
+    account_dba.create([](account_object& o) { o.name = "bob"; });
+    // clang-format on
+    game_dba.create([](game_object& o) {});
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        // alice wins the first and the last bet, bob the second one
+        matched_bet_dba.create([&](matched_bet_object& o) {
+            o.game_uuid = { 0 };
+            o.market = result_home{};
+            o.bet1_data.better = "alice";
+            o.bet1_data.uuid = uuid_type{ uint8_t(10 + i) };
+            o.bet1_data.stake = ASSET_SCR(100);
+            o.bet1_data.wincase = i == 1 ? wincase_type(result_home::no{}) : wincase_type(result_home::yes{});
+            o.bet2_data.better = "bob";
+            o.bet2_data.uuid = uuid_type{ uint8_t(20 + i) };
+            o.bet2_data.stake = ASSET_SCR(200);
+            o.bet2_data.wincase = i == 1 ? wincase_type(result_home::yes{}) : wincase_type(result_home::no{});
+        });
+    }
+    dprop_dba.create([&](dynamic_global_property_object& o) { o.betting_stats.matched_bets_volume = ASSET_SCR(900); });
+
+    std::vector<operation> ops;
+    mocks.OnCall(vop_emitter, database_virtual_operations_emmiter_i::push_virtual_operation)
+        .With(_)
+        .Do([&](const operation& o) { ops.push_back(o); });
+
+    betting_resolver resolver(account_svc, *vop_emitter, matched_bet_dba, game_dba, dprop_dba);
+
+    resolver.resolve_matched_bets({ 0 }, { result_home::yes{} });
+
+    // payouts are batched per better, but the virtual operations still follow the matched bets one by one
+    std::vector<std::pair<account_name_type, uuid_type>> expected
+        = { { "alice", uuid_type{ 10 } }, { "bob", uuid_type{ 21 } }, { "alice", uuid_type{ 12 } } };
+
+    BOOST_REQUIRE_EQUAL(ops.size(), expected.size());
+    for (size_t i = 0; i < ops.size(); ++i)
+    {
+        BOOST_REQUIRE(ops[i].which() == operation::tag<bet_resolved_operation>::value);
+        const auto& resolved = ops[i].get<bet_resolved_operation>();
+        BOOST_CHECK_EQUAL(resolved.better, expected[i].first);
+        BOOST_CHECK(resolved.bet_uuid == expected[i].second);
+        BOOST_CHECK_EQUAL(resolved.income, ASSET_SCR(300));
+        BOOST_CHECK(resolved.kind == bet_resolve_kind::win);
+    }
+
+    BOOST_CHECK_EQUAL(account_dba.get_by<by_name>(account_name_type("alice")).balance, ASSET_SCR(600));
+    BOOST_CHECK_EQUAL(account_dba.get_by<by_name>(account_name_type("bob")).balance, ASSET_SCR(300));
+}
+
 SCORUM_TEST_CASE(cancel_all_bets_should_change_betting_capital)
 {
     account_dba.create([](account_object&) {});
@@ -0,0 +1,157 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/betting_event_stream.hpp>
+
+#include <boost/uuid/uuid_generators.hpp>
+
+#include "defines.hpp"
+
+namespace betting_event_stream_tests {
+
+using namespace scorum;
+using namespace scorum::app;
+using namespace scorum::protocol;
+
+struct fixture
+{
+    uuid_type uuid_ns = boost::uuids::string_generator()("e629f9aa-6b2c-46aa-8fa8-36770e7a7a5f");
+    boost::uuids::name_generator uuid_gen = boost::uuids::name_generator(uuid_ns);
+
+    uuid_type game1 = uuid_gen("game1");
+    uuid_type game2 = uuid_gen("game2");
+
+    std::vector<betting_events_api_object> received;
+
+    std::shared_ptr<betting_event_stream> make_stream(const betting_events_filter& filter, uint32_t limit = 100)
+    {
+        return std::make_shared<betting_event_stream>(
+            [&](const fc::variant& v) { received.push_back(v.as<betting_events_api_object>()); }, filter,
+            [&](int64_t) { return game2; }, limit);
+    }
+
+    void apply_block(betting_event_stream& stream, const std::vector<operation>& ops)
+    {
+        signed_block block;
+
+        stream.on_pre_applied_block(block);
+        for (const auto& op : ops)
+            stream.on_operation(chain::operation_notification(transaction_id_type(), 1, 0, 0, op));
+        stream.on_applied_block(block);
+    }
+
+    uuid_type bet_uuid(const account_name_type& better)
+    {
+        return uuid_gen(std::string(better));
+    }
+
+    operation resolved(const uuid_type& game, const account_name_type& better)
+    {
+        return bet_resolved_operation(game, better, bet_uuid(better), ASSET_SCR(10), bet_resolve_kind::win);
+    }
+
+    operation cancelled(const uuid_type& game, const account_name_type& better)
+    {
+        return bet_cancelled_operation(game, better, bet_uuid(better), ASSET_SCR(10), bet_kind::pending);
+    }
+
+    operation matched(const account_name_type& better1, const account_name_type& better2)
+    {
+        return bets_matched_operation(better1, better2, bet_uuid(better1), bet_uuid(better2), ASSET_SCR(10),
+                                      ASSET_SCR(10), 0);
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(betting_event_stream_tests, fixture)
+
+SCORUM_TEST_CASE(empty_filter_should_send_all_betting_events_once_per_block)
+{
+    auto stream = make_stream({});
+
+    apply_block(*stream,
+                { resolved(game1, "alice"), transfer_operation(), cancelled(game1, "bob"), matched("sam", "bob") });
+
+    BOOST_REQUIRE_EQUAL(received.size(), 1u);
+    BOOST_REQUIRE_EQUAL(received[0].events.size(), 3u);
+    BOOST_CHECK_EQUAL(received[0].dropped, 0u);
+    BOOST_CHECK(received[0].events[0].game_uuid == game1);
+    BOOST_CHECK(received[0].events[1].op.which() == operation::tag<bet_cancelled_operation>::value);
+    // bets_matched_operation gets its game from the matched bet
+    BOOST_CHECK(received[0].events[2].game_uuid == game2);
+}
+
+SCORUM_TEST_CASE(block_without_events_should_not_be_sent)
+{
+    auto stream = make_stream({});
+
+    apply_block(*stream, { transfer_operation() });
+
+    BOOST_CHECK(received.empty());
+}
+
+SCORUM_TEST_CASE(filter_should_pass_listed_games_and_betters)
+{
+    betting_events_filter filter;
+    filter.games = { game1 };
+    filter.betters = { "sam" };
+
+    auto stream = make_stream(filter);
+
+    apply_block(*stream, { resolved(game1, "alice"), resolved(game2, "alice"), cancelled(game2, "sam"),
+                           matched("bob", "sam"), matched("bob", "alice") });
+
+    BOOST_REQUIRE_EQUAL(received.size(), 1u);
+    BOOST_REQUIRE_EQUAL(received[0].events.size(), 3u);
+    BOOST_CHECK(received[0].events[0].op.get<bet_resolved_operation>().game_uuid == game1);
+    BOOST_CHECK(received[0].events[1].op.get<bet_cancelled_operation>().better == "sam");
+    BOOST_CHECK(received[0].events[2].op.get<bets_matched_operation>().better2 == "sam");
+}
+
+SCORUM_TEST_CASE(operations_outside_of_block_should_not_be_sent)
+{
+    auto stream = make_stream({});
+
+    // pending transactions
+    stream->on_operation(chain::operation_notification(transaction_id_type(), 1, 0, 0, resolved(game1, "alice")));
+
+    apply_block(*stream, {});
+
+    BOOST_CHECK(received.empty());
+}
+
+SCORUM_TEST_CASE(events_over_queue_limit_should_be_counted_as_dropped)
+{
+    auto stream = make_stream({}, 2);
+
+    apply_block(*stream, { resolved(game1, "alice"), resolved(game1, "bob"), resolved(game1, "sam"),
+                           resolved(game2, "sam") });
+
+    BOOST_REQUIRE_EQUAL(received.size(), 1u);
+    BOOST_CHECK_EQUAL(received[0].events.size(), 2u);
+    BOOST_CHECK_EQUAL(received[0].dropped, 2u);
+
+    // next block starts with an empty queue
+    apply_block(*stream, { resolved(game1, "alice") });
+
+    BOOST_REQUIRE_EQUAL(received.size(), 2u);
+    BOOST_CHECK_EQUAL(received[1].events.size(), 1u);
+    BOOST_CHECK_EQUAL(received[1].dropped, 0u);
+}
+
+SCORUM_TEST_CASE(stream_should_close_when_subscriber_is_unreachable)
+{
+    size_t calls = 0;
+    auto unreachable = [&](const fc::variant&) {
+        ++calls;
+        FC_THROW("connection closed");
+    };
+    betting_event_stream stream(unreachable, {}, [&](int64_t) { return game1; });
+
+    apply_block(stream, { resolved(game1, "alice") });
+    apply_block(stream, { resolved(game1, "alice") });
+
+    BOOST_CHECK(!stream.is_open());
+    BOOST_CHECK_EQUAL(calls, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
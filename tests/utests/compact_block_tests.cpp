@@ -0,0 +1,74 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/core_messages.hpp>
+#include <graphene/net/message.hpp>
+
+using graphene::net::compact_block_message;
+using graphene::net::block_message;
+using graphene::net::message;
+using scorum::protocol::signed_block;
+using scorum::protocol::signed_transaction;
+
+namespace {
+
+signed_block make_block(size_t trx_count)
+{
+    signed_block block;
+    block.witness = "alice";
+    for (size_t ci = 0; ci < trx_count; ++ci)
+    {
+        signed_transaction trx;
+        trx.ref_block_num = (uint16_t)ci;
+        block.transactions.push_back(trx);
+    }
+    block.transaction_merkle_root = block.calculate_merkle_root();
+    return block;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(compact_block_tests)
+
+BOOST_AUTO_TEST_CASE(short_ids_are_taken_in_block_order)
+{
+    auto block = make_block(3);
+    message full_message(block_message{ block });
+
+    compact_block_message compact(full_message.id(), block);
+
+    BOOST_REQUIRE_EQUAL(compact.short_transaction_ids.size(), 3u);
+    for (size_t ci = 0; ci < block.transactions.size(); ++ci)
+    {
+        BOOST_CHECK_EQUAL(compact.short_transaction_ids[ci],
+                          compact_block_message::short_transaction_id(block.id(), block.transactions[ci].id()));
+    }
+    BOOST_CHECK(compact.header.id() == block.id());
+}
+
+BOOST_AUTO_TEST_CASE(short_ids_are_salted_with_block_id)
+{
+    auto block1 = make_block(1);
+    auto block2 = make_block(1);
+    block2.witness = "bob";
+
+    const auto trx_id = block1.transactions[0].id();
+
+    BOOST_CHECK_NE(compact_block_message::short_transaction_id(block1.id(), trx_id),
+                   compact_block_message::short_transaction_id(block2.id(), trx_id));
+}
+
+BOOST_AUTO_TEST_CASE(reconstructed_block_has_same_message_hash)
+{
+    auto block = make_block(2);
+    message full_message(block_message{ block });
+
+    compact_block_message compact = message(compact_block_message(full_message.id(), block)).as<compact_block_message>();
+
+    signed_block reconstructed;
+    static_cast<scorum::protocol::signed_block_header&>(reconstructed) = compact.header;
+    reconstructed.transactions = block.transactions;
+
+    BOOST_CHECK(reconstructed.calculate_merkle_root() == reconstructed.transaction_merkle_root);
+    BOOST_CHECK(message(block_message{ reconstructed }).id() == compact.item_hash);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,78 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/expiration_scheduler.hpp>
+
+#include "defines.hpp"
+
+#include <set>
+
+namespace {
+
+using namespace scorum::chain;
+
+struct expiration_scheduler_fixture
+{
+    size_t expire_until(int now)
+    {
+        return scheduler.expire(expiration_type::proposal,
+                                [&]() -> const int* {
+                                    return !deadlines.empty() && *deadlines.begin() <= now ? &*deadlines.begin()
+                                                                                           : nullptr;
+                                },
+                                [&](const int&) { deadlines.erase(deadlines.begin()); });
+    }
+
+    expiration_scheduler scheduler;
+    std::set<int> deadlines = { 10, 20, 30, 40 };
+};
+
+BOOST_FIXTURE_TEST_SUITE(expiration_scheduler_tests, expiration_scheduler_fixture)
+
+SCORUM_TEST_CASE(nothing_is_due)
+{
+    BOOST_CHECK_EQUAL(expire_until(5), 0u);
+    BOOST_CHECK_EQUAL(deadlines.size(), 4u);
+
+    auto stats = scheduler.get_stats();
+    BOOST_REQUIRE_EQUAL(stats.count("proposal"), 1u);
+    BOOST_CHECK_EQUAL(stats["proposal"].expired, 0u);
+    BOOST_CHECK_EQUAL(stats["proposal"].blocks, 0u);
+}
+
+SCORUM_TEST_CASE(only_due_objects_expire)
+{
+    BOOST_CHECK_EQUAL(expire_until(20), 2u);
+    BOOST_CHECK(deadlines == std::set<int>({ 30, 40 }));
+
+    BOOST_CHECK_EQUAL(expire_until(25), 0u);
+
+    BOOST_CHECK_EQUAL(expire_until(100), 2u);
+    BOOST_CHECK(deadlines.empty());
+
+    auto stats = scheduler.get_stats()["proposal"];
+    BOOST_CHECK_EQUAL(stats.expired, 4u);
+    BOOST_CHECK_EQUAL(stats.blocks, 2u);
+    BOOST_CHECK_EQUAL(stats.last, 2u);
+    BOOST_CHECK_EQUAL(stats.max, 2u);
+}
+
+SCORUM_TEST_CASE(types_are_counted_separately)
+{
+    expire_until(10);
+    scheduler.add(expiration_type::transaction, 3);
+    scheduler.add(expiration_type::transaction, 0);
+
+    auto stats = scheduler.get_stats();
+    BOOST_CHECK_EQUAL(stats.size(), static_cast<size_t>(expiration_type::types_count));
+    BOOST_CHECK_EQUAL(stats["proposal"].expired, 1u);
+    BOOST_CHECK_EQUAL(stats["transaction"].expired, 3u);
+    BOOST_CHECK_EQUAL(stats["transaction"].blocks, 1u);
+    BOOST_CHECK_EQUAL(stats["transaction"].last, 0u);
+    BOOST_CHECK_EQUAL(stats["transaction"].max, 3u);
+
+    scheduler.clear();
+    BOOST_CHECK_EQUAL(scheduler.get_stats()["transaction"].expired, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
@@ -0,0 +1,95 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/database/fork_database.hpp>
+
+using scorum::chain::fork_database;
+using scorum::protocol::signed_block;
+using scorum::protocol::block_id_type;
+
+namespace {
+
+struct fork_database_fixture
+{
+    fork_database fork_db;
+
+    signed_block make_block(const block_id_type& previous, const std::string& witness = "alice")
+    {
+        signed_block b;
+        b.previous = previous;
+        b.witness = witness;
+        return b;
+    }
+
+    std::vector<signed_block> push_chain(const block_id_type& from, size_t count, const std::string& witness)
+    {
+        std::vector<signed_block> result;
+        block_id_type previous = from;
+        for (size_t ci = 0; ci < count; ++ci)
+        {
+            result.push_back(make_block(previous, witness));
+            fork_db.push_block(result.back());
+            previous = result.back().id();
+        }
+        return result;
+    }
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(fork_database_tests, fork_database_fixture)
+
+BOOST_AUTO_TEST_CASE(main_branch_lookup_follows_head)
+{
+    auto genesis = make_block(block_id_type());
+    fork_db.start_block(genesis);
+
+    auto main = push_chain(genesis.id(), 4, "alice");
+
+    BOOST_REQUIRE_EQUAL(fork_db.head()->num, 5u);
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(1)->id == genesis.id());
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(3)->id == main[1].id());
+    BOOST_CHECK(!fork_db.fetch_block_on_main_branch_by_number(6));
+
+    // fork from block #3 which becomes longer than the main branch
+    auto fork = push_chain(main[1].id(), 3, "bob");
+
+    BOOST_REQUIRE(fork_db.head()->id == fork.back().id());
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(3)->id == main[1].id());
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(4)->id == fork[0].id());
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(6)->id == fork[2].id());
+
+    fork_db.set_head(fork_db.fetch_block(main.back().id()));
+
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(4)->id == main[2].id());
+    BOOST_CHECK(!fork_db.fetch_block_on_main_branch_by_number(6));
+
+    fork_db.pop_block();
+
+    BOOST_CHECK(fork_db.head()->id == main[2].id());
+    BOOST_CHECK(!fork_db.walk_main_branch_to_num(5));
+}
+
+BOOST_AUTO_TEST_CASE(main_branch_is_trimmed_with_max_size)
+{
+    auto genesis = make_block(block_id_type());
+    fork_db.start_block(genesis);
+
+    auto main = push_chain(genesis.id(), 9, "alice");
+
+    fork_db.set_max_size(3);
+
+    BOOST_CHECK(!fork_db.fetch_block_on_main_branch_by_number(6));
+    BOOST_CHECK(fork_db.fetch_block_on_main_branch_by_number(7)->id == main[5].id());
+}
+
+BOOST_AUTO_TEST_CASE(item_caches_packed_block)
+{
+    auto genesis = make_block(block_id_type());
+    fork_db.start_block(genesis);
+
+    auto item = fork_db.head();
+
+    BOOST_CHECK(item->packed_data() == fc::raw::pack(genesis));
+    BOOST_CHECK(&item->packed_data() == &item->packed_data());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
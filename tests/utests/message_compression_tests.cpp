@@ -0,0 +1,78 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/core_messages.hpp>
+#include <graphene/net/message.hpp>
+
+using graphene::net::block_message;
+using graphene::net::compressed_message;
+using graphene::net::message;
+using scorum::protocol::signed_block;
+using scorum::protocol::signed_transaction;
+
+namespace {
+
+message make_block_message(size_t trx_count)
+{
+    signed_block block;
+    block.witness = "alice";
+    for (size_t ci = 0; ci < trx_count; ++ci)
+    {
+        signed_transaction trx;
+        trx.ref_block_num = (uint16_t)ci;
+        block.transactions.push_back(trx);
+    }
+    return message(block_message{ block });
+}
+}
+
+BOOST_AUTO_TEST_SUITE(message_compression_tests)
+
+BOOST_AUTO_TEST_CASE(compressed_message_restores_original)
+{
+    message original = make_block_message(100);
+
+    auto compressed = graphene::net::compress_message(original);
+
+    BOOST_REQUIRE(compressed.valid());
+    BOOST_CHECK_EQUAL(compressed->msg_type, (uint32_t)compressed_message::type);
+    BOOST_CHECK_LT(compressed->size, original.size);
+
+    message restored = graphene::net::decompress_message(*compressed);
+
+    BOOST_CHECK_EQUAL(restored.msg_type, original.msg_type);
+    BOOST_CHECK_EQUAL(restored.size, original.size);
+    BOOST_CHECK(restored.data == original.data);
+    BOOST_CHECK(restored.id() == original.id());
+}
+
+BOOST_AUTO_TEST_CASE(incompressible_message_is_not_compressed)
+{
+    message original;
+    original.msg_type = block_message::type;
+    original.data = { 'a' };
+    original.size = (uint32_t)original.data.size();
+
+    BOOST_CHECK(!graphene::net::compress_message(original).valid());
+}
+
+BOOST_AUTO_TEST_CASE(decompress_rejects_wrong_uncompressed_size)
+{
+    auto compressed = graphene::net::compress_message(make_block_message(100));
+    BOOST_REQUIRE(compressed.valid());
+
+    auto envelope = compressed->as<compressed_message>();
+    envelope.uncompressed_size += 1;
+
+    BOOST_CHECK_THROW(graphene::net::decompress_message(message(envelope)), fc::exception);
+}
+
+BOOST_AUTO_TEST_CASE(decompress_rejects_oversized_message)
+{
+    compressed_message envelope;
+    envelope.msg_type = block_message::type;
+    envelope.uncompressed_size = MAX_MESSAGE_SIZE + 1;
+
+    BOOST_CHECK_THROW(graphene::net::decompress_message(message(envelope)), fc::exception);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
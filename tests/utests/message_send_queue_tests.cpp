@@ -0,0 +1,343 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/core_messages.hpp>
+#include <graphene/net/message_send_queue.hpp>
+#include <graphene/net/peer_connection.hpp>
+
+#include <deque>
+
+using graphene::net::message_priority;
+using graphene::net::message_send_queue;
+
+namespace {
+
+struct queued_item
+{
+    message_priority priority;
+    int64_t queued_at_us;
+    size_t size;
+};
+
+using item_queue = message_send_queue<queued_item>;
+
+fc::time_point at(int64_t us)
+{
+    return fc::time_point(fc::microseconds(us));
+}
+
+item_queue::push_result push(item_queue& queue, message_priority priority, size_t size, int64_t now_us = 0)
+{
+    return queue.push(priority, std::unique_ptr<queued_item>(new queued_item{ priority, now_us, size }), size,
+                      at(now_us));
+}
+
+item_queue::push_result push_solicited(item_queue& queue, message_priority priority, size_t size)
+{
+    return queue.push_solicited(priority, std::unique_ptr<queued_item>(new queued_item{ priority, 0, size }), size,
+                                at(0));
+}
+
+/// the single FIFO queue peer_connection had before, advertisements are capped by the same budget for a fair comparison
+struct fifo_send_queue
+{
+    item_queue::push_result
+    push(message_priority priority, std::unique_ptr<queued_item> msg, size_t size, fc::time_point)
+    {
+        if (priority == message_priority::advertisement)
+        {
+            if (advertisement_bytes + size > GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES)
+                return item_queue::push_result::dropped;
+            advertisement_bytes += size;
+        }
+        queue.emplace_back(std::move(msg));
+        return item_queue::push_result::queued;
+    }
+
+    bool empty() const
+    {
+        return queue.empty();
+    }
+
+    std::unique_ptr<queued_item> pop(fc::time_point)
+    {
+        auto msg = std::move(queue.front());
+        queue.pop_front();
+        if (msg->priority == message_priority::advertisement)
+            advertisement_bytes -= msg->size;
+        return msg;
+    }
+
+    std::deque<std::unique_ptr<queued_item>> queue;
+    size_t advertisement_bytes = 0;
+};
+
+/**
+ * A peer link of 1 byte/us is saturated by a stream of item advertisements arriving 20% faster than it sends them,
+ * a block is queued every block interval. Block latency is the time from queueing the block to the end of its
+ * transmission.
+ */
+struct saturated_link_simulation
+{
+    static constexpr size_t bytes_per_us = 1;
+    static constexpr size_t advertisement_size = 300;
+    static constexpr int64_t advertisement_interval_us = 250;
+    static constexpr size_t block_size = 20'000;
+    static constexpr int64_t block_interval_us = 3'000'000;
+    static constexpr size_t blocks_count = 20;
+
+    template <typename Queue> void run(Queue& queue)
+    {
+        int64_t now = 0;
+        int64_t link_free = 0;
+        int64_t next_advertisement = 0;
+        int64_t next_block = block_interval_us;
+
+        while (blocks_sent < blocks_count)
+        {
+            int64_t next_arrival = std::min(next_advertisement, next_block);
+            if (!queue.empty() && link_free <= next_arrival)
+            {
+                now = std::max(now, link_free);
+                auto msg = queue.pop(at(now));
+                link_free = now + (int64_t)(msg->size / bytes_per_us);
+
+                if (msg->priority == message_priority::block)
+                {
+                    int64_t latency = link_free - msg->queued_at_us;
+                    max_block_latency_us = std::max(max_block_latency_us, latency);
+                    total_block_latency_us += latency;
+                    ++blocks_sent;
+                }
+                else
+                {
+                    ++advertisements_sent;
+                }
+            }
+            else if (next_block <= next_advertisement)
+            {
+                now = next_block;
+                push_item(queue, message_priority::block, block_size, now);
+                next_block += block_interval_us;
+            }
+            else
+            {
+                now = next_advertisement;
+                if (push_item(queue, message_priority::advertisement, advertisement_size, now)
+                    == item_queue::push_result::dropped)
+                    ++advertisements_dropped;
+                next_advertisement += advertisement_interval_us;
+            }
+        }
+    }
+
+    template <typename Queue>
+    static item_queue::push_result push_item(Queue& queue, message_priority priority, size_t size, int64_t now)
+    {
+        auto result = queue.push(priority, std::unique_ptr<queued_item>(new queued_item{ priority, now, size }), size,
+                                 at(now));
+        BOOST_REQUIRE(result != item_queue::push_result::overflow);
+        return result;
+    }
+
+    int64_t max_block_latency_us = 0;
+    int64_t total_block_latency_us = 0;
+    size_t blocks_sent = 0;
+    size_t advertisements_sent = 0;
+    size_t advertisements_dropped = 0;
+};
+
+/// the node side of a peer_connection which isn't connected anywhere
+struct idle_peer_delegate : public graphene::net::peer_connection_delegate
+{
+    void on_message(graphene::net::peer_connection*, const graphene::net::message&) override
+    {
+    }
+
+    void on_connection_closed(graphene::net::peer_connection*) override
+    {
+    }
+
+    graphene::net::message get_message_for_item(const graphene::net::item_id&) override
+    {
+        FC_THROW("no items");
+    }
+};
+}
+
+BOOST_AUTO_TEST_SUITE(message_send_queue_tests)
+
+BOOST_AUTO_TEST_CASE(message_types_are_mapped_to_priorities)
+{
+    using namespace graphene::net;
+
+    BOOST_CHECK(get_message_priority(block_message_type) == message_priority::block);
+    BOOST_CHECK(get_message_priority(compact_block_message_type) == message_priority::block);
+    BOOST_CHECK(get_message_priority(compact_block_transactions_message_type) == message_priority::block);
+    BOOST_CHECK(get_message_priority(hello_message_type) == message_priority::block);
+    BOOST_CHECK(get_message_priority(blockchain_item_ids_inventory_message_type) == message_priority::sync);
+    BOOST_CHECK(get_message_priority(fetch_blockchain_item_ids_message_type) == message_priority::sync);
+    BOOST_CHECK(get_message_priority(item_ids_inventory_message_type) == message_priority::advertisement);
+    BOOST_CHECK(get_message_priority(fetch_items_message_type) == message_priority::inventory);
+    BOOST_CHECK(get_message_priority(item_not_available_message_type) == message_priority::inventory);
+    BOOST_CHECK(get_message_priority(trx_message_type) == message_priority::transaction);
+}
+
+BOOST_AUTO_TEST_CASE(classes_are_sent_by_priority_and_fifo_within_class)
+{
+    item_queue queue;
+
+    push(queue, message_priority::transaction, 1);
+    push(queue, message_priority::inventory, 2);
+    push(queue, message_priority::transaction, 3);
+    push(queue, message_priority::block, 4);
+    push(queue, message_priority::sync, 5);
+    push(queue, message_priority::block, 6);
+    push(queue, message_priority::advertisement, 7);
+
+    std::vector<size_t> sent;
+    while (!queue.empty())
+        sent.push_back(queue.pop()->size);
+
+    std::vector<size_t> expected = { 4, 6, 5, 2, 7, 1, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(sent.begin(), sent.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(queue.total_bytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(advertisements_over_budget_are_dropped)
+{
+    item_queue queue;
+
+    BOOST_CHECK(push(queue, message_priority::advertisement, GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES)
+                == item_queue::push_result::queued);
+    BOOST_CHECK(push(queue, message_priority::advertisement, 1) == item_queue::push_result::dropped);
+
+    // other classes are not limited by the advertisements budget
+    BOOST_CHECK(push(queue, message_priority::block, 1) == item_queue::push_result::queued);
+
+    auto stats = queue.get_stats();
+    BOOST_CHECK_EQUAL(stats["advertisement"].queued_messages, 1u);
+    BOOST_CHECK_EQUAL(stats["advertisement"].dropped_messages, 1u);
+    BOOST_CHECK_EQUAL(queue.total_bytes(), GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES + 1);
+}
+
+BOOST_AUTO_TEST_CASE(solicited_transactions_are_not_dropped)
+{
+    item_queue queue;
+    const size_t budget = GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES;
+
+    BOOST_CHECK(push(queue, message_priority::advertisement, budget) == item_queue::push_result::queued);
+
+    // a reply to fetch_items is queued beyond the advertisements budget, the requester waits for it
+    BOOST_CHECK(push_solicited(queue, message_priority::transaction, budget) == item_queue::push_result::queued);
+    BOOST_CHECK(push_solicited(queue, message_priority::transaction, 2) == item_queue::push_result::queued);
+
+    auto stats = queue.get_stats();
+    BOOST_CHECK_EQUAL(stats["transaction"].queued_messages, 2u);
+    BOOST_CHECK_EQUAL(stats["transaction"].dropped_messages, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(solicited_messages_overflow_total_budget)
+{
+    item_queue queue;
+
+    BOOST_CHECK(push(queue, message_priority::block, GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)
+                == item_queue::push_result::queued);
+    BOOST_CHECK(push_solicited(queue, message_priority::transaction, 1) == item_queue::push_result::overflow);
+}
+
+BOOST_AUTO_TEST_CASE(other_classes_over_budget_overflow)
+{
+    item_queue queue;
+
+    BOOST_CHECK(push(queue, message_priority::block, GRAPHENE_NET_MAXIMUM_QUEUED_MESSAGES_IN_BYTES)
+                == item_queue::push_result::queued);
+    BOOST_CHECK(push(queue, message_priority::sync, 1) == item_queue::push_result::overflow);
+
+    // the total limit drops advertisements as well
+    BOOST_CHECK(push(queue, message_priority::advertisement, 1) == item_queue::push_result::dropped);
+}
+
+BOOST_AUTO_TEST_CASE(stats_track_depth_and_waiting_time)
+{
+    item_queue queue;
+
+    push(queue, message_priority::block, 100, 0);
+    push(queue, message_priority::block, 50, 10);
+
+    auto stats = queue.get_stats();
+    BOOST_CHECK_EQUAL(stats.size(), graphene::net::message_priorities_count);
+    BOOST_CHECK_EQUAL(stats["block"].queued_messages, 2u);
+    BOOST_CHECK_EQUAL(stats["block"].queued_bytes, 150u);
+
+    queue.pop(at(30));
+    queue.pop(at(40));
+
+    stats = queue.get_stats();
+    BOOST_CHECK_EQUAL(stats["block"].queued_messages, 0u);
+    BOOST_CHECK_EQUAL(stats["block"].queued_bytes, 0u);
+    BOOST_CHECK_EQUAL(stats["block"].max_queued_bytes, 150u);
+    BOOST_CHECK_EQUAL(stats["block"].sent_messages, 2u);
+    BOOST_CHECK_EQUAL(stats["block"].total_wait_us, 60u);
+    BOOST_CHECK_EQUAL(stats["block"].max_wait_us, 30u);
+}
+
+BOOST_AUTO_TEST_CASE(block_latency_under_saturated_advertisement_stream)
+{
+    using simulation = saturated_link_simulation;
+    const size_t blocks = simulation::blocks_count;
+
+    saturated_link_simulation prioritized;
+    {
+        item_queue queue;
+        prioritized.run(queue);
+    }
+
+    saturated_link_simulation fifo;
+    {
+        fifo_send_queue queue;
+        fifo.run(queue);
+    }
+
+    for (const auto& result : { std::make_pair("priority", &prioritized), std::make_pair("fifo", &fifo) })
+    {
+        BOOST_TEST_MESSAGE(result.first << " queue: block latency max " << result.second->max_block_latency_us
+                                        << "us, avg " << result.second->total_block_latency_us / (int64_t)blocks
+                                        << "us, sent advertisements " << result.second->advertisements_sent
+                                        << ", dropped advertisements " << result.second->advertisements_dropped);
+    }
+
+    // a block waits only for the advertisement on the wire
+    BOOST_CHECK_LE(prioritized.max_block_latency_us,
+                   (int64_t)((simulation::block_size + simulation::advertisement_size) / simulation::bytes_per_us));
+
+    // behind the whole advertisement backlog otherwise
+    BOOST_CHECK_GT(fifo.max_block_latency_us,
+                   (int64_t)(GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES / 2 / simulation::bytes_per_us));
+
+    BOOST_CHECK_GT(prioritized.advertisements_dropped, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(peer_connection_drops_advertisements_over_budget)
+{
+    using namespace graphene::net;
+
+    idle_peer_delegate delegate;
+    peer_connection_ptr peer = peer_connection::make_shared(&delegate);
+
+    // the send task doesn't run until we yield, so everything stays queued
+    std::vector<item_hash_t> hashes(1000);
+    message advertisement(item_ids_inventory_message(trx_message_type, hashes));
+    const size_t count = GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES / advertisement.data.size() + 10;
+    for (size_t i = 0; i < count; ++i)
+        peer->send_message(advertisement);
+
+    auto stats = peer->get_send_queue_stats()["advertisement"];
+    BOOST_CHECK_GT(stats.dropped_messages, 0u);
+    BOOST_CHECK_LE(stats.queued_bytes, GRAPHENE_NET_MAXIMUM_QUEUED_ADVERTISEMENTS_IN_BYTES);
+    BOOST_CHECK_EQUAL(stats.queued_messages + stats.dropped_messages, count);
+
+    // dropping isn't an overflow, the connection stays
+    BOOST_CHECK(peer->negotiation_status != peer_connection::connection_negotiation_status::closing);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
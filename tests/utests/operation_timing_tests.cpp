@@ -0,0 +1,113 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/operation_timing.hpp>
+
+#include <scorum/protocol/operations.hpp>
+
+#include "defines.hpp"
+
+namespace {
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+const int transfer_tag = operation::tag<transfer_operation>::value;
+const int vote_tag = operation::tag<vote_operation>::value;
+
+BOOST_AUTO_TEST_SUITE(operation_timing_tests)
+
+SCORUM_TEST_CASE(empty_when_nothing_evaluated)
+{
+    operation_timing timing;
+
+    BOOST_CHECK(timing.get_stats().empty());
+}
+
+SCORUM_TEST_CASE(stats_are_named_by_operation)
+{
+    operation_timing timing;
+
+    timing.add(transfer_tag, 10);
+    timing.add(transfer_tag, 30, true);
+    timing.add(vote_tag, 5);
+
+    auto stats = timing.get_stats();
+
+    BOOST_REQUIRE_EQUAL(stats.size(), 2u);
+    BOOST_REQUIRE(stats.count("transfer"));
+    BOOST_REQUIRE(stats.count("vote"));
+
+    BOOST_CHECK_EQUAL(stats["transfer"].count, 2u);
+    BOOST_CHECK_EQUAL(stats["transfer"].failed, 1u);
+    BOOST_CHECK_EQUAL(stats["transfer"].total, 40u);
+    BOOST_CHECK_EQUAL(stats["transfer"].mean, 20u);
+    BOOST_CHECK_EQUAL(stats["transfer"].max, 30u);
+
+    BOOST_CHECK_EQUAL(stats["vote"].count, 1u);
+    BOOST_CHECK_EQUAL(stats["vote"].failed, 0u);
+}
+
+SCORUM_TEST_CASE(histogram_buckets_are_powers_of_two)
+{
+    operation_timing timing;
+
+    timing.add(transfer_tag, 0); // bucket 0: < 1us
+    timing.add(transfer_tag, 1); // bucket 1: < 2us
+    timing.add(transfer_tag, 3); // bucket 2: < 4us
+    timing.add(transfer_tag, 4); // bucket 3: < 8us
+    timing.add(transfer_tag, 7); // bucket 3
+
+    auto histogram = timing.get_stats()["transfer"].histogram;
+
+    const std::vector<uint64_t> expected = { 1, 1, 1, 2 };
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(histogram.begin(), histogram.end(), expected.begin(), expected.end());
+}
+
+SCORUM_TEST_CASE(percentiles_are_bucket_bounds)
+{
+    operation_timing timing;
+
+    for (int i = 0; i < 90; ++i)
+        timing.add(transfer_tag, 3);
+    for (int i = 0; i < 10; ++i)
+        timing.add(transfer_tag, 100);
+
+    auto stats = timing.get_stats()["transfer"];
+
+    BOOST_CHECK_EQUAL(stats.p50, 4u);
+    BOOST_CHECK_EQUAL(stats.p90, 4u);
+    BOOST_CHECK_EQUAL(stats.p99, 100u);
+    BOOST_CHECK_EQUAL(stats.max, 100u);
+}
+
+SCORUM_TEST_CASE(scope_records_failure_unless_succeeded)
+{
+    operation_timing timing;
+
+    {
+        operation_timing::scope s(timing, transfer_tag);
+        s.succeeded();
+    }
+    {
+        operation_timing::scope s(timing, transfer_tag);
+    }
+
+    auto stats = timing.get_stats()["transfer"];
+
+    BOOST_CHECK_EQUAL(stats.count, 2u);
+    BOOST_CHECK_EQUAL(stats.failed, 1u);
+}
+
+SCORUM_TEST_CASE(clear_drops_samples)
+{
+    operation_timing timing;
+
+    timing.add(transfer_tag, 10);
+    timing.clear();
+
+    BOOST_CHECK(timing.get_stats().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
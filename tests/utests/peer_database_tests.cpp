@@ -0,0 +1,180 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/config.hpp>
+#include <graphene/net/peer_database.hpp>
+#include <graphene/utilities/tempdir.hpp>
+
+#include <fc/filesystem.hpp>
+#include <fc/io/json.hpp>
+
+#include <boost/filesystem.hpp>
+
+using graphene::net::peer_database;
+using graphene::net::potential_peer_record;
+
+namespace {
+
+struct peer_database_fixture
+{
+    peer_database_fixture()
+        : data_dir(graphene::utilities::temp_directory_path())
+        , filename(data_dir.path() / "peers.dat")
+        , json_filename(data_dir.path() / "peers.json")
+    {
+    }
+
+    static potential_peer_record make_record(uint32_t i)
+    {
+        potential_peer_record record(fc::ip::endpoint(fc::ip::address(0x0a000000 + i), 1776),
+                                     fc::time_point_sec(1000 + i), graphene::net::last_connection_succeeded);
+        record.number_of_successful_connection_attempts = i;
+        return record;
+    }
+
+    static uint32_t successful_attempts(peer_database& db, uint32_t i)
+    {
+        auto record = db.lookup_entry_for_endpoint(make_record(i).endpoint);
+        BOOST_REQUIRE(record.valid());
+        return record->number_of_successful_connection_attempts;
+    }
+
+    fc::temp_directory data_dir;
+    fc::path filename;
+    fc::path json_filename;
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE(peer_database_tests, peer_database_fixture)
+
+BOOST_AUTO_TEST_CASE(updates_and_erases_survive_reopen)
+{
+    {
+        peer_database db;
+        db.open(filename);
+        for (uint32_t i = 0; i < 10; ++i)
+            db.update_entry(make_record(i));
+
+        auto updated = make_record(3);
+        updated.number_of_successful_connection_attempts = 100;
+        db.update_entry(updated);
+
+        db.erase(make_record(5).endpoint);
+    }
+
+    peer_database db;
+    db.open(filename);
+
+    BOOST_CHECK_EQUAL(db.size(), 9u);
+    BOOST_CHECK_EQUAL(successful_attempts(db, 3), 100u);
+    BOOST_CHECK_EQUAL(successful_attempts(db, 9), 9u);
+    BOOST_CHECK(!db.lookup_entry_for_endpoint(make_record(5).endpoint).valid());
+}
+
+BOOST_AUTO_TEST_CASE(json_database_is_migrated)
+{
+    std::vector<potential_peer_record> records;
+    for (uint32_t i = 0; i < 10; ++i)
+        records.push_back(make_record(i));
+    fc::json::save_to_file(records, json_filename);
+
+    {
+        peer_database db;
+        db.open(filename, json_filename);
+        BOOST_CHECK_EQUAL(db.size(), 10u);
+    }
+
+    BOOST_REQUIRE(fc::exists(filename));
+
+    // the binary file is used from now on
+    fc::remove(json_filename);
+
+    peer_database db;
+    db.open(filename, json_filename);
+
+    BOOST_CHECK_EQUAL(db.size(), 10u);
+    BOOST_CHECK_EQUAL(successful_attempts(db, 7), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_record_is_dropped)
+{
+    {
+        peer_database db;
+        db.open(filename);
+        for (uint32_t i = 0; i < 10; ++i)
+            db.update_entry(make_record(i));
+    }
+
+    boost::filesystem::resize_file(filename.generic_string(), fc::file_size(filename) - 3);
+
+    {
+        peer_database db;
+        db.open(filename);
+        BOOST_CHECK_EQUAL(db.size(), 9u);
+        BOOST_CHECK(!db.lookup_entry_for_endpoint(make_record(9).endpoint).valid());
+
+        db.update_entry(make_record(9));
+    }
+
+    peer_database db;
+    db.open(filename);
+    BOOST_CHECK_EQUAL(db.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(overridden_records_are_compacted)
+{
+    peer_database db;
+    db.open(filename);
+    db.update_entry(make_record(0));
+    db.flush();
+
+    auto single_record_size = fc::file_size(filename);
+
+    for (uint32_t ci = 0; ci < GRAPHENE_PEER_DATABASE_MIN_COMPACTION_RECORDS * 3; ++ci)
+    {
+        auto updated = make_record(0);
+        updated.number_of_failed_connection_attempts = ci;
+        db.update_entry(updated);
+    }
+
+    BOOST_CHECK_LE(fc::file_size(filename), single_record_size * (GRAPHENE_PEER_DATABASE_MIN_COMPACTION_RECORDS + 1));
+    BOOST_CHECK_EQUAL(db.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(updates_are_written_in_batches)
+{
+    peer_database db;
+    db.open(filename);
+
+    auto empty_size = fc::file_size(filename);
+
+    for (uint32_t i = 0; i < 10; ++i)
+        db.update_entry(make_record(i));
+
+    // nothing is written until the flush interval passes
+    BOOST_CHECK_EQUAL(fc::file_size(filename), empty_size);
+
+    db.flush();
+
+    BOOST_CHECK_GT(fc::file_size(filename), empty_size);
+
+    peer_database reopened;
+    reopened.open(filename);
+    BOOST_CHECK_EQUAL(reopened.size(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(cleared_database_stays_empty)
+{
+    {
+        peer_database db;
+        db.open(filename);
+        for (uint32_t i = 0; i < 10; ++i)
+            db.update_entry(make_record(i));
+        db.clear();
+    }
+
+    peer_database db;
+    db.open(filename);
+    BOOST_CHECK_EQUAL(db.size(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,176 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/chain/signature_cache.hpp>
+
+#include <scorum/protocol/exceptions.hpp>
+#include <scorum/protocol/operations.hpp>
+
+#include "defines.hpp"
+
+namespace {
+
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+struct signature_cache_fixture
+{
+    signature_cache_fixture()
+    {
+        transfer_operation op;
+        op.from = "alice";
+        op.to = "bob";
+        op.amount = ASSET_SCR(1);
+
+        trx.operations.push_back(op);
+        trx.set_expiration(fc::time_point_sec(1000));
+        trx.sign(alice_key, chain_id);
+        trx.sign(bob_key, chain_id);
+    }
+
+    chain_id_type chain_id = chain_id_type::hash(std::string("signature_cache_tests"));
+    private_key_type alice_key = private_key_type::regenerate(fc::sha256::hash(std::string("alice")));
+    private_key_type bob_key = private_key_type::regenerate(fc::sha256::hash(std::string("bob")));
+
+    signed_transaction trx;
+};
+
+BOOST_FIXTURE_TEST_SUITE(signature_cache_tests, signature_cache_fixture)
+
+SCORUM_TEST_CASE(keys_are_recovered_once)
+{
+    signature_cache cache;
+
+    auto keys = cache.get_signature_keys(trx, chain_id);
+
+    BOOST_CHECK(keys == trx.get_signature_keys(chain_id));
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().hits, 0u);
+
+    BOOST_CHECK(cache.get_signature_keys(trx, chain_id) == keys);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().hits, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().size, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().hit_rate, 50.0);
+}
+
+SCORUM_TEST_CASE(changed_transaction_is_recovered_anew)
+{
+    signature_cache cache;
+
+    cache.get_signature_keys(trx, chain_id);
+
+    // the signatures stay the same, but they are not valid for the new content anymore
+    trx.set_expiration(fc::time_point_sec(2000));
+
+    auto keys = cache.get_signature_keys(trx, chain_id);
+
+    BOOST_CHECK(keys == trx.get_signature_keys(chain_id));
+    BOOST_CHECK(keys.count(alice_key.get_public_key()) == 0);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 4u);
+}
+
+SCORUM_TEST_CASE(other_chain_is_recovered_anew)
+{
+    signature_cache cache;
+
+    cache.get_signature_keys(trx, chain_id);
+    cache.get_signature_keys(trx, chain_id_type::hash(std::string("other")));
+
+    BOOST_CHECK_EQUAL(cache.get_stats().hits, 0u);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 4u);
+}
+
+SCORUM_TEST_CASE(duplicate_signature_is_rejected)
+{
+    signature_cache cache;
+
+    trx.signatures.push_back(trx.signatures.front());
+
+    BOOST_CHECK_THROW(cache.get_signature_keys(trx, chain_id), tx_duplicate_sig);
+}
+
+SCORUM_TEST_CASE(oldest_entries_are_evicted)
+{
+    signature_cache cache(3);
+
+    cache.get_signature_keys(trx, chain_id);
+
+    signed_transaction other = trx;
+    other.set_expiration(fc::time_point_sec(2000));
+    other.signatures.clear();
+    other.sign(bob_key, chain_id);
+
+    cache.get_signature_keys(other, chain_id);
+    BOOST_CHECK_EQUAL(cache.get_stats().size, 3u);
+
+    other.sign(alice_key, chain_id);
+    cache.get_signature_keys(other, chain_id);
+
+    BOOST_CHECK_EQUAL(cache.get_stats().size, 3u);
+    BOOST_CHECK_EQUAL(cache.get_stats().hits, 1u);
+
+    // the first signature of trx was evicted, recovering it again evicts the second one
+    cache.get_signature_keys(trx, chain_id);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 6u);
+    BOOST_CHECK_EQUAL(cache.get_stats().size, 3u);
+}
+
+SCORUM_TEST_CASE(prefetched_keys_are_found_by_get_signature_keys)
+{
+    signature_cache cache;
+
+    BOOST_CHECK_EQUAL(cache.prefetch(trx, chain_id), 2u);
+    BOOST_CHECK_EQUAL(cache.prefetch(trx, chain_id), 0u);
+
+    BOOST_CHECK(cache.get_signature_keys(trx, chain_id) == trx.get_signature_keys(chain_id));
+    BOOST_CHECK_EQUAL(cache.get_stats().prefetched, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().hits, 2u);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 0u);
+}
+
+SCORUM_TEST_CASE(prefetch_rejects_duplicate_signature)
+{
+    signature_cache cache;
+
+    trx.signatures.push_back(trx.signatures.front());
+
+    BOOST_CHECK_THROW(cache.prefetch(trx, chain_id), tx_duplicate_sig);
+}
+
+SCORUM_TEST_CASE(recovery_threads_are_reused_for_blocks)
+{
+    signature_cache cache;
+
+    BOOST_CHECK_EQUAL(cache.recover_in_parallel({ trx }, chain_id), 0u);
+
+    cache.set_recovery_threads(4);
+    BOOST_CHECK_EQUAL(cache.get_recovery_threads(), 4u);
+
+    signed_transaction other = trx;
+    other.set_expiration(fc::time_point_sec(2000));
+    other.signatures.clear();
+    other.sign(alice_key, chain_id);
+
+    BOOST_CHECK_EQUAL(cache.recover_in_parallel({ trx }, chain_id), 2u);
+    BOOST_CHECK_EQUAL(cache.recover_in_parallel({ trx, other }, chain_id), 1u);
+
+    BOOST_CHECK(cache.get_signature_keys(other, chain_id) == other.get_signature_keys(chain_id));
+    BOOST_CHECK_EQUAL(cache.get_stats().prefetched, 3u);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 0u);
+
+    cache.set_recovery_threads(1);
+    BOOST_CHECK_EQUAL(cache.get_recovery_threads(), 0u);
+}
+
+SCORUM_TEST_CASE(disabled_cache_is_not_filled)
+{
+    signature_cache cache;
+    cache.set_enabled(false);
+
+    BOOST_CHECK(cache.get_signature_keys(trx, chain_id) == trx.get_signature_keys(chain_id));
+    BOOST_CHECK_EQUAL(cache.get_stats().size, 0u);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
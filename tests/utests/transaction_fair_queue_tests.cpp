@@ -0,0 +1,316 @@
+#include <boost/test/unit_test.hpp>
+
+#include <graphene/net/transaction_fair_queue.hpp>
+
+#include <deque>
+
+using graphene::net::transaction_fair_queue;
+using graphene::net::transaction_rate_limit;
+
+namespace {
+
+/// transactions are their send times in milliseconds, peers are numbers
+using transaction_queue = transaction_fair_queue<int, int64_t>;
+
+fc::time_point at_ms(int64_t ms)
+{
+    return fc::time_point(fc::milliseconds(ms));
+}
+
+transaction_rate_limit make_limit(uint32_t transactions_per_second, uint32_t burst, uint32_t max_queued)
+{
+    transaction_rate_limit limit;
+    limit.transactions_per_second = transactions_per_second;
+    limit.burst = burst;
+    limit.max_queued = max_queued;
+    return limit;
+}
+
+/**
+ * Flooding peers send 5000 transactions per second each, well-behaved ones 20. The delegate handles a transaction
+ * in 2ms, so it can't keep up with the flood. Latency is the time from sending a transaction to handling it.
+ */
+struct flooding_simulation
+{
+    static constexpr int flooders_count = 2;
+    static constexpr int peers_count = 5;
+    static constexpr int64_t flood_per_ms = 5;
+    static constexpr int64_t honest_interval_ms = 50;
+    static constexpr int64_t handling_ms = 2;
+    static constexpr int64_t duration_ms = 10'000;
+
+    static bool is_flooder(int peer)
+    {
+        return peer < flooders_count;
+    }
+
+    /// Queue has the try_request/push/ready_count/pop/complete of transaction_queue
+    template <typename Queue> void run(Queue& queue)
+    {
+        for (int64_t now = 0; now < duration_ms; ++now)
+        {
+            for (int peer = 0; peer < peers_count; ++peer)
+            {
+                if (is_flooder(peer))
+                {
+                    for (int64_t ci = 0; ci < flood_per_ms; ++ci)
+                        send(queue, peer, now);
+                }
+                else if (now % honest_interval_ms == peer)
+                {
+                    send(queue, peer, now);
+                    ++honest_sent;
+                }
+            }
+
+            if (now % handling_ms == 0 && queue.ready_count() > 0)
+            {
+                auto next = queue.pop();
+                queue.complete(next.first, true);
+                if (is_flooder(next.first))
+                {
+                    ++flood_handled;
+                }
+                else
+                {
+                    ++honest_handled;
+                    max_honest_latency_ms = std::max(max_honest_latency_ms, now + handling_ms - next.second);
+                }
+            }
+        }
+    }
+
+    /// the transaction is advertised, requested if the peer isn't over its rate, then received
+    template <typename Queue> static void send(Queue& queue, int peer, int64_t now)
+    {
+        if (queue.try_request(peer, at_ms(now)))
+            queue.push(peer, now);
+    }
+
+    size_t honest_sent = 0;
+    size_t honest_handled = 0;
+    size_t flood_handled = 0;
+    int64_t max_honest_latency_ms = 0;
+};
+
+/// all transactions in arrival order, as node_impl handled them before
+struct fifo_queue
+{
+    bool try_request(int, const fc::time_point&)
+    {
+        return true;
+    }
+
+    void push(int peer, int64_t trx)
+    {
+        queue.emplace_back(peer, trx);
+    }
+
+    size_t ready_count() const
+    {
+        return queue.size();
+    }
+
+    std::pair<int, int64_t> pop()
+    {
+        auto result = queue.front();
+        queue.pop_front();
+        return result;
+    }
+
+    void complete(int, bool)
+    {
+    }
+
+    std::deque<std::pair<int, int64_t>> queue;
+};
+}
+
+BOOST_AUTO_TEST_SUITE(transaction_fair_queue_tests)
+
+BOOST_AUTO_TEST_CASE(burst_is_let_in_then_rate)
+{
+    transaction_queue queue;
+    queue.set_limit(make_limit(10, 5, 100));
+
+    for (int64_t ci = 0; ci < 5; ++ci)
+        BOOST_CHECK(queue.try_request(1, at_ms(0)));
+    BOOST_CHECK(!queue.try_request(1, at_ms(0)));
+    BOOST_CHECK(queue.next_request_time(1) == at_ms(100));
+
+    // a token per 100ms
+    BOOST_CHECK(!queue.try_request(1, at_ms(99)));
+    BOOST_CHECK(queue.try_request(1, at_ms(120)));
+    BOOST_CHECK(!queue.try_request(1, at_ms(130)));
+    BOOST_CHECK(queue.next_request_time(1) >= at_ms(200));
+    BOOST_CHECK(queue.try_request(1, queue.next_request_time(1)));
+
+    // other peers have their own buckets
+    BOOST_CHECK(queue.try_request(2, at_ms(130)));
+
+    BOOST_CHECK_EQUAL(queue.get_stats(1).rate_limited, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(zero_rate_disables_limit)
+{
+    transaction_queue queue;
+    queue.set_limit(make_limit(0, 0, 1000));
+
+    for (int64_t ci = 0; ci < 1000; ++ci)
+        BOOST_REQUIRE(queue.try_request(1, at_ms(0)));
+}
+
+BOOST_AUTO_TEST_CASE(peer_over_max_queued_is_dropped)
+{
+    transaction_queue queue;
+    queue.set_limit(make_limit(0, 0, 2));
+
+    queue.push(1, 0);
+    queue.push(1, 1);
+    BOOST_CHECK(queue.push(1, 2) == transaction_queue::push_result::queue_full);
+
+    queue.pop();
+    BOOST_CHECK(queue.push(1, 3) == transaction_queue::push_result::queued);
+    BOOST_CHECK_EQUAL(queue.get_stats(1).queue_full, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(dropped_transaction_token_is_given_back)
+{
+    transaction_queue queue;
+    queue.set_limit(make_limit(10, 2, 1));
+
+    BOOST_REQUIRE(queue.try_request(1, at_ms(0)));
+    BOOST_REQUIRE(queue.try_request(1, at_ms(0)));
+    BOOST_CHECK(queue.push(1, 0) == transaction_queue::push_result::queued);
+    BOOST_CHECK(queue.push(1, 1) == transaction_queue::push_result::queue_full);
+
+    BOOST_CHECK(queue.try_request(1, at_ms(0)));
+    BOOST_CHECK(!queue.try_request(1, at_ms(0)));
+}
+
+BOOST_AUTO_TEST_CASE(peers_are_served_in_turn)
+{
+    transaction_queue queue;
+
+    queue.push(1, 10);
+    queue.push(1, 11);
+    queue.push(1, 12);
+    queue.push(2, 20);
+    queue.push(3, 30);
+    queue.push(3, 31);
+
+    std::vector<int64_t> served;
+    while (queue.ready_count() > 0)
+    {
+        auto next = queue.pop();
+        served.push_back(next.second);
+        queue.complete(next.first, true);
+    }
+
+    std::vector<int64_t> expected = { 10, 20, 30, 11, 31, 12 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(served.begin(), served.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(peer_with_transaction_in_flight_is_skipped)
+{
+    transaction_queue queue;
+
+    queue.push(1, 10);
+    queue.push(1, 11);
+    queue.push(2, 20);
+
+    BOOST_CHECK_EQUAL(queue.pop().second, 10);
+    BOOST_CHECK_EQUAL(queue.pop().second, 20);
+
+    // 11 waits for 10 to be handled
+    BOOST_CHECK_EQUAL(queue.size(), 1u);
+    BOOST_CHECK_EQUAL(queue.ready_count(), 0u);
+
+    queue.push(1, 12);
+    BOOST_CHECK_EQUAL(queue.ready_count(), 0u);
+
+    queue.complete(1, true);
+    BOOST_REQUIRE_EQUAL(queue.ready_count(), 1u);
+    BOOST_CHECK_EQUAL(queue.pop().second, 11);
+    BOOST_CHECK_EQUAL(queue.ready_count(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(removed_peer_transactions_are_dropped)
+{
+    transaction_queue queue;
+
+    queue.push(1, 10);
+    queue.push(2, 20);
+    queue.push(1, 11);
+
+    BOOST_CHECK_EQUAL(queue.pop().second, 10);
+    queue.complete(1, true);
+    queue.remove_peer(1);
+
+    BOOST_CHECK_EQUAL(queue.size(), 1u);
+    BOOST_CHECK_EQUAL(queue.pop().second, 20);
+    BOOST_CHECK(queue.empty());
+    BOOST_CHECK_EQUAL(queue.get_stats(1).accepted, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(handling_results_are_counted)
+{
+    transaction_queue queue;
+
+    queue.push(1, 10);
+    queue.push(1, 11);
+
+    queue.complete(queue.pop().first, true);
+    queue.complete(queue.pop().first, false);
+
+    auto stats = queue.get_stats(1);
+    BOOST_CHECK_EQUAL(stats.accepted, 1u);
+    BOOST_CHECK_EQUAL(stats.rejected, 1u);
+    BOOST_CHECK_EQUAL(stats.queued, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(well_behaved_peers_are_served_during_flood)
+{
+    using simulation = flooding_simulation;
+
+    transaction_queue queue;
+    queue.set_limit(make_limit(100, 200, 100));
+
+    flooding_simulation fair;
+    fair.run(queue);
+
+    fifo_queue fifo_transactions;
+    flooding_simulation fifo;
+    fifo.run(fifo_transactions);
+
+    for (const auto& result : { std::make_pair("fair", &fair), std::make_pair("fifo", &fifo) })
+    {
+        BOOST_TEST_MESSAGE(result.first << " queue: well-behaved transactions handled " << result.second->honest_handled
+                                        << " of " << result.second->honest_sent << ", max latency "
+                                        << result.second->max_honest_latency_ms << "ms, flood transactions handled "
+                                        << result.second->flood_handled);
+    }
+
+    for (int peer = 0; peer < simulation::peers_count; ++peer)
+    {
+        auto stats = queue.get_stats(peer);
+        if (simulation::is_flooder(peer))
+        {
+            BOOST_CHECK_GT(stats.rate_limited, 0u);
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL(stats.rate_limited, 0u);
+            BOOST_CHECK_EQUAL(stats.queue_full, 0u);
+        }
+    }
+
+    // every well-behaved transaction waits for a transaction of each other peer at most
+    BOOST_CHECK_EQUAL(fair.honest_handled, fair.honest_sent);
+    BOOST_CHECK_LE(fair.max_honest_latency_ms, (int64_t)(simulation::peers_count * simulation::handling_ms));
+
+    BOOST_CHECK_LT(fifo.honest_handled, fifo.honest_sent);
+    BOOST_CHECK_GT(fifo.max_honest_latency_ms, 1000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,214 @@
+#include <boost/test/unit_test.hpp>
+
+#include <scorum/app/transaction_prevalidator.hpp>
+
+#include <scorum/protocol/operations.hpp>
+
+#include <fc/bitutil.hpp>
+
+#include "defines.hpp"
+
+namespace {
+
+using namespace scorum::app;
+using namespace scorum::chain;
+using namespace scorum::protocol;
+
+struct transaction_prevalidator_fixture
+{
+    transaction_prevalidator_fixture()
+    {
+        head.block_num = 10;
+        head.block_id = make_block_id(10, "head");
+        head.time = fc::time_point_sec(1000);
+        head.max_transaction_size = 1024;
+
+        prevalidator.set_head(head);
+
+        trx = make_transaction(head.time + 60);
+    }
+
+    static block_id_type make_block_id(uint32_t num, const std::string& seed)
+    {
+        block_id_type id = fc::ripemd160::hash(seed);
+        id._hash[0] = fc::endian_reverse_u32(num);
+        return id;
+    }
+
+    signed_transaction make_transaction(const fc::time_point_sec& expiration)
+    {
+        transfer_operation op;
+        op.from = "alice";
+        op.to = "bob";
+        op.amount = ASSET_SCR(1);
+
+        signed_transaction result;
+        result.operations.push_back(op);
+        result.set_expiration(expiration);
+        result.set_reference_block(head.block_id);
+        result.sign(alice_key, chain_id);
+        return result;
+    }
+
+    void process(const signed_transaction& t)
+    {
+        prevalidator.process(t, [&](const signed_transaction& pushed_trx) {
+            BOOST_CHECK(cache.get_signature_keys(pushed_trx, chain_id) == pushed_trx.get_signature_keys(chain_id));
+            ++pushed;
+        });
+    }
+
+    uint64_t rejections(const std::string& reason)
+    {
+        return prevalidator.get_stats().rejections[reason];
+    }
+
+    chain_id_type chain_id = chain_id_type::hash(std::string("transaction_prevalidator_tests"));
+    private_key_type alice_key = private_key_type::regenerate(fc::sha256::hash(std::string("alice")));
+
+    signature_cache cache;
+    transaction_prevalidator prevalidator{ cache, chain_id, 0 };
+
+    transaction_prevalidator::head_state head;
+    signed_transaction trx;
+
+    size_t pushed = 0;
+};
+
+BOOST_FIXTURE_TEST_SUITE(transaction_prevalidator_tests, transaction_prevalidator_fixture)
+
+SCORUM_TEST_CASE(valid_transaction_is_pushed_with_prefetched_signatures)
+{
+    process(trx);
+
+    BOOST_CHECK_EQUAL(pushed, 1u);
+    BOOST_CHECK_EQUAL(cache.get_stats().prefetched, 1u);
+    BOOST_CHECK_EQUAL(cache.get_stats().misses, 0u);
+
+    auto stats = prevalidator.get_stats();
+    BOOST_CHECK_EQUAL(stats.stages["stateless"].passed, 1u);
+    BOOST_CHECK_EQUAL(stats.stages["signatures"].passed, 1u);
+    BOOST_CHECK_EQUAL(stats.stages["push"].passed, 1u);
+    BOOST_CHECK(stats.rejections.empty());
+    BOOST_CHECK_EQUAL(stats.in_progress, 0u);
+}
+
+SCORUM_TEST_CASE(pushed_transaction_is_rejected_as_duplicate_until_it_expires)
+{
+    process(trx);
+
+    BOOST_CHECK_THROW(process(trx), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("duplicate"), 1u);
+    BOOST_CHECK_EQUAL(pushed, 1u);
+
+    // the chain forgets the transaction as well
+    head.time = trx.expiration;
+    prevalidator.set_head(head);
+
+    BOOST_CHECK_THROW(process(trx), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("expired"), 1u);
+    BOOST_CHECK_EQUAL(rejections("duplicate"), 1u);
+}
+
+SCORUM_TEST_CASE(transaction_rejected_by_chain_can_be_pushed_again)
+{
+    BOOST_CHECK_THROW(prevalidator.process(trx, [](const signed_transaction&) { FC_THROW("insufficient funds"); }),
+                      fc::exception);
+    BOOST_CHECK_EQUAL(rejections("chain"), 1u);
+    BOOST_CHECK_EQUAL(prevalidator.get_stats().in_progress, 0u);
+
+    process(trx);
+
+    BOOST_CHECK_EQUAL(pushed, 1u);
+}
+
+SCORUM_TEST_CASE(expiration_out_of_window_is_rejected)
+{
+    BOOST_CHECK_THROW(process(make_transaction(head.time)), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("expired"), 1u);
+
+    BOOST_CHECK_THROW(process(make_transaction(head.time + SCORUM_MAX_TIME_UNTIL_EXPIRATION + 1)), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("expiration_too_far"), 1u);
+
+    BOOST_CHECK_EQUAL(pushed, 0u);
+    BOOST_CHECK_EQUAL(prevalidator.get_stats().stages["stateless"].rejected, 2u);
+}
+
+SCORUM_TEST_CASE(reference_to_other_block_with_known_number_is_rejected)
+{
+    trx.set_reference_block(make_block_id(10, "fork"));
+    trx.signatures.clear();
+    trx.sign(alice_key, chain_id);
+
+    BOOST_CHECK_THROW(process(trx), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("tapos"), 1u);
+
+    // the chain checks blocks unknown to the prevalidator
+    trx.set_reference_block(make_block_id(9, "before start"));
+    trx.signatures.clear();
+    trx.sign(alice_key, chain_id);
+
+    process(trx);
+    BOOST_CHECK_EQUAL(pushed, 1u);
+}
+
+SCORUM_TEST_CASE(popped_block_is_not_checked_for_reference)
+{
+    prevalidator.forget_block(head.block_num);
+
+    trx.set_reference_block(make_block_id(10, "fork"));
+    trx.signatures.clear();
+    trx.sign(alice_key, chain_id);
+
+    process(trx);
+    BOOST_CHECK_EQUAL(pushed, 1u);
+}
+
+SCORUM_TEST_CASE(invalid_and_too_large_transactions_are_rejected)
+{
+    signed_transaction empty = trx;
+    empty.operations.clear();
+
+    BOOST_CHECK_THROW(process(empty), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("invalid"), 1u);
+
+    head.max_transaction_size = 10;
+    prevalidator.set_head(head);
+
+    BOOST_CHECK_THROW(process(trx), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("too_large"), 1u);
+
+    BOOST_CHECK_EQUAL(pushed, 0u);
+}
+
+SCORUM_TEST_CASE(duplicate_signature_is_rejected_before_push)
+{
+    signed_transaction bad = trx;
+    bad.signatures.push_back(bad.signatures.front());
+
+    BOOST_CHECK_THROW(process(bad), fc::exception);
+    BOOST_CHECK_EQUAL(rejections("signature"), 1u);
+    BOOST_CHECK_EQUAL(prevalidator.get_stats().stages["signatures"].rejected, 1u);
+    BOOST_CHECK_EQUAL(prevalidator.get_stats().in_progress, 0u);
+
+    process(trx);
+    BOOST_CHECK_EQUAL(pushed, 1u);
+}
+
+SCORUM_TEST_CASE(stages_run_on_worker_threads)
+{
+    transaction_prevalidator threaded(cache, chain_id, 2);
+    threaded.set_head(head);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        threaded.process(make_transaction(head.time + 60 + i), [&](const signed_transaction&) { ++pushed; });
+    }
+
+    BOOST_CHECK_EQUAL(pushed, 10u);
+    BOOST_CHECK_EQUAL(threaded.get_stats().stages["signatures"].passed, 10u);
+    BOOST_CHECK_EQUAL(cache.get_stats().prefetched, 10u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}